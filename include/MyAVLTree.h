@@ -0,0 +1,465 @@
+#ifndef MYAVLTREE_H
+#define MYAVLTREE_H
+
+#include "MySmallStack.h" // 迭代插入 / 删除 / 遍历用的栈
+#include "MyTreeRange.h"  // 区间查询
+#include <cstddef>
+#include <functional>
+#include <utility>        // std::move
+
+/*
+ * MyAVLTree: 自平衡的二叉搜索树 (AVL 树)
+ *
+ * MyBST 不做任何平衡，按顺序插入 (比如以时间戳为键) 时会退化成一条链表：每次操作 O(n)，
+ * 递归的 _insert / _remove 还会把调用栈压爆。AVL 树在每个节点上多记一个 height，
+ * 保证任意节点左右子树的高度差不超过 1，树高不超过 1.44 * log2(n + 2)，所有操作都是 O(log n)。
+ *
+ *   - 节点同样维护子树大小 size，和 MyBST::Node 含义相同；
+ *   - insert / remove 是迭代的：下降时把经过的“父节点指向子节点的指针”压进 MySmallStack，
+ *     回溯时沿着这条路径更新 size / height 并在失衡处旋转。树高有上面的保证，路径永远放在内联缓冲区里；
+ *   - 接口与 MyBST 一致 (insert / find / remove / lower_bound / find_value / 三种遍历 ...)，
+ *     可以作为 MySet / MyMap 的底层引擎：MySet<int, MyAVLTree>。
+ */
+template <typename T>
+class MyAVLTree {
+private:
+    struct Node {
+        T data;
+        Node* left;
+        Node* right;
+        size_t size;   // 子树中的节点个数
+        int height;    // 子树高度，叶子为 1
+
+        Node(const T& value)
+            : data(value), left(nullptr), right(nullptr), size(1), height(1) {}
+    };
+
+    // 路径最多 1.44 * log2(n) 层，64 层足够任何能放进内存的树
+    static constexpr size_t MAX_PATH = 64;
+    using PathStack = MySmallStack<Node**, MAX_PATH>;
+    using WalkStack = MySmallStack<const Node*, MAX_PATH>;
+
+    Node* _root;
+
+    static size_t _size(const Node* node) { return node ? node->size : 0; }
+    static int _height(const Node* node) { return node ? node->height : 0; }
+
+    static void _update(Node* node) {
+        node->size = 1 + _size(node->left) + _size(node->right);
+        int hl = _height(node->left);
+        int hr = _height(node->right);
+        node->height = 1 + (hl > hr ? hl : hr);
+    }
+
+    /*
+     *       x                y
+     *      / \              / \
+     *     a   y    ==>     x   c
+     *        / \          / \
+     *       b   c        a   b
+     */
+    static void _rotate_left(Node*& link) {
+        Node* x = link;
+        Node* y = x->right;
+        x->right = y->left;
+        y->left = x;
+        _update(x);
+        _update(y);
+        link = y;
+    }
+
+    static void _rotate_right(Node*& link) {
+        Node* y = link;
+        Node* x = y->left;
+        y->left = x->right;
+        x->right = y;
+        _update(y);
+        _update(x);
+        link = x;
+    }
+
+    // 更新 link 指向的节点，左右高度差为 2 时旋转 (LL / LR / RR / RL 四种情况)
+    static void _rebalance(Node*& link) {
+        Node* node = link;
+        _update(node);
+        int balance = _height(node->left) - _height(node->right);
+        if (balance > 1) {
+            if (_height(node->left->left) < _height(node->left->right)) _rotate_left(node->left); // LR
+            _rotate_right(link);
+        }
+        else if (balance < -1) {
+            if (_height(node->right->right) < _height(node->right->left)) _rotate_right(node->right); // RL
+            _rotate_left(link);
+        }
+    }
+
+    // 沿着下降路径自底向上修复
+    static void _fix_path(PathStack& path) {
+        while (!path.empty()) {
+            _rebalance(*path.top());
+            path.pop();
+        }
+    }
+
+    void _destroy_tree(Node* node);
+    Node* _copy_tree(const Node* other_node) const;
+    Node* _find_node(const T& value) const;
+
+    template <typename ForwardIt>
+    static Node* _build_balanced(size_t n, ForwardIt& it, ForwardIt last);
+
+public:
+    MyAVLTree() : _root(nullptr) {}
+    MyAVLTree(const MyAVLTree& other) : _root(_copy_tree(other._root)) {}
+    MyAVLTree& operator=(const MyAVLTree& other);
+    MyAVLTree(MyAVLTree&& other) noexcept : _root(other._root) { other._root = nullptr; }
+    MyAVLTree& operator=(MyAVLTree&& other) noexcept;
+    ~MyAVLTree() { _destroy_tree(_root); }
+
+    void insert(const T& value);
+    bool find(const T& value) const { return _find_node(value) != nullptr; }
+    void remove(const T& value);
+    void clear();
+
+    // 用升序的区间 [first, last) 替换整棵树的内容，O(n)：每次取中间的元素当根，左右子树大小最多差 1，
+    // 天然满足 AVL 的平衡条件，不需要任何旋转。相等的相邻元素只保留一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last);
+
+    void inorder(std::function<void(const T&)> func) const;
+    void preorder(std::function<void(const T&)> func) const;
+    void postorder(std::function<void(const T&)> func) const;
+
+    Node* lower_bound(const T& value) const;
+    Node* upper_bound(const T& value) const;
+
+    size_t size() const { return _size(_root); }
+    bool empty() const { return _root == nullptr; }
+    int height() const { return _height(_root); }
+
+    T* find_value(const T& value_to_find) const;
+
+    // 顺序统计，与 MyBST 相同：第 k 小 (从 0 开始)、严格小于 value 的个数、[lo, hi) 中的个数，都是 O(log n)
+    T* select(size_t k) const;
+    size_t rank(const T& value) const;
+    size_t count_in_range(const T& lo, const T& hi) const;
+
+    // 区间查询 [lo, hi)，O(log n + k)；visitor 返回 bool 时，返回 false 就提前结束
+    using range_iterator = MyTreeRangeIterator<Node, T, &Node::data>;
+    MyIteratorRange<range_iterator> range(const T& lo, const T& hi) const {
+        return {range_iterator(_root, lo, hi), range_iterator()};
+    }
+    template <typename Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor&& visit) const {
+        for (const T& value : range(lo, hi)) {
+            if (!my_range_visit(visit, value)) return;
+        }
+    }
+
+    // 检查有序性、平衡因子、height 和 size 是否都正确 (测试用，O(n))
+    bool is_valid() const;
+};
+
+template <typename T>
+void MyAVLTree<T>::_destroy_tree(Node* node) {
+    // 树高是 O(log n) 的，递归不会太深
+    if (node == nullptr) return;
+    _destroy_tree(node->left);
+    _destroy_tree(node->right);
+    delete node;
+}
+
+template <typename T>
+typename MyAVLTree<T>::Node* MyAVLTree<T>::_copy_tree(const Node* other_node) const {
+    if (other_node == nullptr) return nullptr;
+    Node* node = new Node(other_node->data);
+    node->left = _copy_tree(other_node->left);
+    node->right = _copy_tree(other_node->right);
+    node->size = other_node->size;
+    node->height = other_node->height;
+    return node;
+}
+
+template <typename T>
+MyAVLTree<T>& MyAVLTree<T>::operator=(const MyAVLTree& other) {
+    if (this == &other) return *this;
+    Node* copy = _copy_tree(other._root);
+    _destroy_tree(_root);
+    _root = copy;
+    return *this;
+}
+
+template <typename T>
+MyAVLTree<T>& MyAVLTree<T>::operator=(MyAVLTree&& other) noexcept {
+    if (this != &other) {
+        _destroy_tree(_root);
+        _root = other._root;
+        other._root = nullptr;
+    }
+    return *this;
+}
+
+template <typename T>
+typename MyAVLTree<T>::Node* MyAVLTree<T>::_find_node(const T& value) const {
+    Node* node = _root;
+    while (node != nullptr) {
+        if (value < node->data) node = node->left;
+        else if (node->data < value) node = node->right;
+        else return node;
+    }
+    return nullptr;
+}
+
+template <typename T>
+void MyAVLTree<T>::insert(const T& value) {
+    PathStack path;
+    Node** link = &_root;
+    while (*link != nullptr) {
+        Node* node = *link;
+        if (value < node->data) {
+            path.push(link);
+            link = &node->left;
+        }
+        else if (node->data < value) {
+            path.push(link);
+            link = &node->right;
+        }
+        else {
+            return; // 已存在，和 MyBST 一样什么都不做 (路径上的 size 还没动过)
+        }
+    }
+    *link = new Node(value);
+    _fix_path(path);
+}
+
+template <typename T>
+void MyAVLTree<T>::remove(const T& value) {
+    PathStack path;
+    Node** link = &_root;
+    while (*link != nullptr && ((*link)->data < value || value < (*link)->data)) {
+        path.push(link);
+        link = value < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    Node* target = *link;
+    if (target == nullptr) return; // 不存在
+
+    // 有两棵子树：和 MyBST 一样用中序后继的数据覆盖 target，再摘掉后继 (它没有左孩子)
+    if (target->left != nullptr && target->right != nullptr) {
+        path.push(link);
+        link = &target->right;
+        while ((*link)->left != nullptr) {
+            path.push(link);
+            link = &(*link)->left;
+        }
+        target->data = std::move((*link)->data);
+    }
+
+    Node* victim = *link;
+    *link = victim->left != nullptr ? victim->left : victim->right;
+    delete victim;
+    _fix_path(path);
+}
+
+template <typename T>
+void MyAVLTree<T>::clear() {
+    _destroy_tree(_root);
+    _root = nullptr;
+}
+
+template <typename T>
+void MyAVLTree<T>::inorder(std::function<void(const T&)> func) const {
+    WalkStack stack;
+    const Node* node = _root;
+    while (node != nullptr || !stack.empty()) {
+        while (node != nullptr) {
+            stack.push(node);
+            node = node->left;
+        }
+        node = stack.top();
+        stack.pop();
+        func(node->data);
+        node = node->right;
+    }
+}
+
+template <typename T>
+void MyAVLTree<T>::preorder(std::function<void(const T&)> func) const {
+    if (_root == nullptr) return;
+    WalkStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const Node* node = stack.top();
+        stack.pop();
+        func(node->data);
+        if (node->right) stack.push(node->right);
+        if (node->left) stack.push(node->left);
+    }
+}
+
+template <typename T>
+void MyAVLTree<T>::postorder(std::function<void(const T&)> func) const {
+    WalkStack stack;
+    const Node* node = _root;
+    const Node* last_visited = nullptr;
+    while (node != nullptr || !stack.empty()) {
+        if (node != nullptr) {
+            stack.push(node);
+            node = node->left;
+            continue;
+        }
+        const Node* top = stack.top();
+        if (top->right != nullptr && top->right != last_visited) {
+            node = top->right;
+        }
+        else {
+            func(top->data);
+            last_visited = top;
+            stack.pop();
+        }
+    }
+}
+
+template <typename T>
+// 找到第一个不小于 value 的值
+typename MyAVLTree<T>::Node* MyAVLTree<T>::lower_bound(const T& value) const {
+    Node* result = nullptr;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (!(node->data < value)) {
+            result = node;
+            node = node->left;
+        }
+        else {
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+template <typename T>
+// 找到第一个严格大于 value 的值
+typename MyAVLTree<T>::Node* MyAVLTree<T>::upper_bound(const T& value) const {
+    Node* result = nullptr;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (value < node->data) {
+            result = node;
+            node = node->left;
+        }
+        else {
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+template <typename T>
+T* MyAVLTree<T>::find_value(const T& value_to_find) const {
+    Node* node = _find_node(value_to_find);
+    return node ? &node->data : nullptr;
+}
+
+template <typename T>
+template <typename ForwardIt>
+typename MyAVLTree<T>::Node* MyAVLTree<T>::_build_balanced(size_t n, ForwardIt& it, ForwardIt last) {
+    if (n == 0) return nullptr;
+    size_t left_size = n / 2;
+    Node* left = _build_balanced(left_size, it, last);
+
+    Node* node = new Node(*it);
+    do { ++it; } while (it != last && !(node->data < *it)); // 跳过重复的元素
+
+    node->left = left;
+    node->right = _build_balanced(n - 1 - left_size, it, last);
+    _update(node);
+    return node;
+}
+
+template <typename T>
+template <typename ForwardIt>
+void MyAVLTree<T>::build_from_sorted(ForwardIt first, ForwardIt last) {
+    size_t n = my_count_sorted_unique(first, last);
+    Node* new_root = _build_balanced(n, first, last);
+    _destroy_tree(_root);
+    _root = new_root;
+}
+
+template <typename T>
+T* MyAVLTree<T>::select(size_t k) const {
+    Node* node = _root;
+    while (node != nullptr) {
+        size_t left_size = _size(node->left);
+        if (k < left_size) {
+            node = node->left;
+        }
+        else if (k == left_size) {
+            return &node->data;
+        }
+        else {
+            k -= left_size + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+template <typename T>
+size_t MyAVLTree<T>::rank(const T& value) const {
+    size_t result = 0;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (node->data < value) {
+            result += 1 + _size(node->left);
+            node = node->right;
+        }
+        else {
+            node = node->left;
+        }
+    }
+    return result;
+}
+
+template <typename T>
+size_t MyAVLTree<T>::count_in_range(const T& lo, const T& hi) const {
+    if (!(lo < hi)) return 0;
+    return rank(hi) - rank(lo);
+}
+
+template <typename T>
+bool MyAVLTree<T>::is_valid() const {
+    // 后序遍历：子树都检查过之后再检查自己
+    WalkStack stack;
+    const Node* node = _root;
+    const Node* last_visited = nullptr;
+    while (node != nullptr || !stack.empty()) {
+        if (node != nullptr) {
+            stack.push(node);
+            node = node->left;
+            continue;
+        }
+        const Node* top = stack.top();
+        if (top->right != nullptr && top->right != last_visited) {
+            node = top->right;
+            continue;
+        }
+        if (top->left && !(top->left->data < top->data)) return false;
+        if (top->right && !(top->data < top->right->data)) return false;
+        int hl = _height(top->left);
+        int hr = _height(top->right);
+        if (hl - hr > 1 || hr - hl > 1) return false;
+        if (top->height != 1 + (hl > hr ? hl : hr)) return false;
+        if (top->size != 1 + _size(top->left) + _size(top->right)) return false;
+        last_visited = top;
+        stack.pop();
+    }
+    // 局部的父子有序不代表整棵树有序，再用中序遍历确认一遍
+    bool ordered = true;
+    const T* prev = nullptr;
+    inorder([&](const T& value) {
+        if (prev != nullptr && !(*prev < value)) ordered = false;
+        prev = &value;
+    });
+    return ordered;
+}
+
+#endif
@@ -1,8 +1,13 @@
 #ifndef MYBST_H
 #define MYBST_H
 
+#include "MySmallStack.h" // 迭代遍历用的栈
+#include "MyTreeRange.h"  // 区间查询
 #include <iostream>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <utility>
 
 template <typename T>
 class MyBST {
@@ -11,10 +16,11 @@ private:
         T data;
         Node* left;
         Node* right;
+        Node* parent; // 父节点：迭代器靠它在树上移动，插入 / 删除后靠它回溯更新 size
         size_t size;
 
-        Node(const T& value)
-            : data(value), left(nullptr), right(nullptr), size(1){}
+        Node(const T& value, Node* parent_node = nullptr)
+            : data(value), left(nullptr), right(nullptr), parent(parent_node), size(1){}
     };
 
 /*
@@ -25,24 +31,29 @@ private:
 
     Node* _root; // 一棵树，只需要一个根节点就够了
 
-    void _destroy_tree(Node* node);// 私有辅助函数：递归地释放树的内存
-    Node* _copy_tree(Node* other_node) const;// 速度拷贝函数
+    // MyBST 不做平衡，按顺序插入时树高等于节点数。所以所有操作都是迭代的：
+    // 查找 / 插入 / 删除沿着指针下降，再沿 parent 回溯更新 size；遍历用显式的栈。
+    // 树再深也不会把调用栈压爆
+    void _destroy_tree(Node* node);// 私有辅助函数：释放整棵树的内存
+    Node* _copy_tree(const Node* other_node) const;// 深度拷贝函数
 
-    Node* _insert(Node* node, const T& value);
+    Node* _find_node(const T& value) const;
 
-    bool _find(Node* node, const T& value) const;
+    // 遍历用显式的栈代替递归：树高不超过 32 时栈完全放在 MySmallStack 的内联缓冲区里，不分配内存；
+    // 树退化成链表时也只是溢出到堆上
+    using WalkStack = MySmallStack<const Node*, 32>;
 
-    // 三种遍历方法
-    void _inorder(Node* node, std::function<void(const T&)> func) const;
-    void _preorder(Node* node, std::function<void(const T&)> func) const;
-    void _postorder(Node* node, std::function<void(const T&)> func) const;
+    static Node* _find_min(Node* node);
+    static Node* _find_max(Node* node);
+    static const Node* _successor(const Node* node);
+    static const Node* _predecessor(const Node* node);
 
-    // 找到第一个不小于/严格大于 value 的值
-    Node* _lower_bound(Node* node, const T& value) const;
-    Node* _upper_bound(Node* node, const T& value) const;
+    // 用 child 替换 node 在父节点 (或 _root) 中的位置
+    void _replace_child(Node* node, Node* child);
 
-    Node* _remove(Node* node, const T& value);
-    Node* _find_min(Node* node) const;
+    // 从有序区间中按中序依次取出 n 个 (去重后的) 元素，建成一棵完全平衡的子树
+    template <typename ForwardIt>
+    static Node* _build_balanced(size_t n, ForwardIt& it, ForwardIt last, Node* parent);
 
     // 递归查找size，虽然复杂度为O(n)，但容易维护，
     /* 这是单纯二叉搜索树的缺陷，即删除和更新size的操作没办法同步，只有下一个函数才知道有没有成功删除
@@ -59,6 +70,57 @@ private:
     // size_t _size(Node* node) const;
 
 public:
+    /*
+     * 中序迭代器 (双向)：++ 走到中序后继，-- 走到中序前驱，都只靠 parent 指针，不需要栈。
+     * 单步最坏 O(h)，走完整棵树每条边只经过两次，总共 O(n)。
+     * 和 std::set 一样只提供只读访问：改了 data 就可能破坏搜索树的有序性。
+     * end() 是空节点；对 end() 做 -- 得到最大的元素，所以迭代器里还要记着所属的树。
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : _node(nullptr), _tree(nullptr) {}
+
+        reference operator*() const { return _node->data; }
+        pointer operator->() const { return &_node->data; }
+
+        const_iterator& operator++() {
+            _node = _successor(_node);
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        const_iterator& operator--() {
+            _node = _node == nullptr ? _find_max(_tree->_root) : _predecessor(_node);
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const_iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator& other) const { return _node == other._node; }
+        bool operator!=(const const_iterator& other) const { return _node != other._node; }
+
+    private:
+        friend class MyBST;
+        const Node* _node;
+        const MyBST* _tree;
+
+        const_iterator(const Node* node, const MyBST* tree) : _node(node), _tree(tree) {}
+    };
+    using iterator = const_iterator;
+
     MyBST() : _root(nullptr) {}
     MyBST(const MyBST& other); // 拷贝函数
     MyBST<T>& operator=(const MyBST<T>& other);
@@ -67,10 +129,21 @@ public:
     void insert(const T& value);
     bool find(const T& value) const;
 
-    // 三种遍历方法
-    void inorder(std::function<void(const T&)> func) const;
-    void preorder(std::function<void(const T&)> func) const;
-    void postorder(std::function<void(const T&)> func) const;
+    const_iterator begin() const { return const_iterator(_find_min(_root), this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_iterator find_iter(const T& value) const { return const_iterator(_find_node(value), this); }
+
+    // 三种遍历方法 (经过 std::function，每访问一个节点一次间接调用)
+    void inorder(std::function<void(const T&)> func) const { visit_inorder(func); }
+    void preorder(std::function<void(const T&)> func) const { visit_preorder(func); }
+    void postorder(std::function<void(const T&)> func) const { visit_postorder(func); }
+
+    // 模板版本：visitor 的类型在编译期已知，可以被内联进遍历循环
+    template <typename Visitor> void visit_inorder(Visitor&& visit) const;
+    template <typename Visitor> void visit_preorder(Visitor&& visit) const;
+    template <typename Visitor> void visit_postorder(Visitor&& visit) const;
 
     Node* lower_bound(const T& value) const;
     Node* upper_bound(const T& value) const;
@@ -78,39 +151,78 @@ public:
     void remove(const T& value);
     void clear();
 
+    // 用升序的区间 [first, last) 替换整棵树的内容，O(n)：
+    // 每次取中间的元素当根，得到一棵完全平衡的树 (树高 floor(log2 n) + 1)，而逐个 insert 有序数据会退化成 O(n^2)。
+    // 相等的相邻元素只保留一个；输入无序时抛出 std::invalid_argument，原来的树保持不变
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last);
+
     size_t size() const;
     bool empty() const;
+    int height() const; // 空树为 0，只有根节点为 1
 
     T* find_value(const T& value_to_find) const;
+
+    // 区间查询 [lo, hi)：先 O(h) 定位到第一个不小于 lo 的节点，再沿中序往后走 k 步，
+    // 只碰和区间有交集的那部分树。visitor 返回 bool 时，返回 false 就提前结束
+    using range_iterator = const_iterator;
+    MyIteratorRange<const_iterator> range(const T& lo, const T& hi) const;
+    template <typename Visitor> void for_each_in_range(const T& lo, const T& hi, Visitor&& visit) const;
+
+    // 顺序统计 (order statistics)：靠每个节点的 size，沿一条从根往下的路径完成，O(h)
+    T* select(size_t k) const;                              // 第 k 小的元素 (k 从 0 开始)，越界返回 nullptr
+    size_t rank(const T& value) const;                      // 严格小于 value 的元素个数
+    size_t count_in_range(const T& lo, const T& hi) const;  // 落在 [lo, hi) 中的元素个数
 };
 
 template <typename T>
 void MyBST<T>::_destroy_tree(Node* node) {
-    if (node == nullptr) {
-        return; // Base case: 如果节点为空，什么都不做
+    // 边走边拆：有左孩子就右旋一次，把左子树挪到右边；没有左孩子就删掉当前节点，继续处理右子树。
+    // 不需要栈，也不需要递归，退化成链表的树同样 O(n)
+    while (node != nullptr) {
+        if (node->left != nullptr) {
+            Node* left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        }
+        else {
+            Node* right = node->right;
+            //std::cout << "Deleting node: " << node->data << std::endl; // 方便调试
+            delete node;
+            node = right;
+        }
     }
-
-    // 后序遍历 (Post-order Traversal) 删除左右子树
-    _destroy_tree(node->left);
-    _destroy_tree(node->right);
-
-    //std::cout << "Deleting node: " << node->data << std::endl; // 方便调试
-    delete node;
 }
 
 template<typename T>
-typename MyBST<T>::Node *MyBST<T>::_copy_tree(Node *other_node) const {
+typename MyBST<T>::Node *MyBST<T>::_copy_tree(const Node *other_node) const {
     if (other_node == nullptr) {
         return nullptr;
     }
 
-    Node* newNode = new Node(other_node->data);
-    newNode->data = other_node->data;
-    newNode->left = _copy_tree(other_node->left);
-    newNode->right = _copy_tree(other_node->right);
-    newNode->size = other_node->size;
-
-    return newNode;
+    // 前序地复制：栈里放 (原节点, 新节点) 对，新节点的孩子在出栈时才创建
+    Node* new_root = new Node(other_node->data);
+    new_root->size = other_node->size;
+    MySmallStack<std::pair<const Node*, Node*>, 32> stack;
+    stack.push({other_node, new_root});
+    while (!stack.empty()) {
+        std::pair<const Node*, Node*> top = stack.top();
+        stack.pop();
+        const Node* src = top.first;
+        Node* dst = top.second;
+        if (src->left) {
+            dst->left = new Node(src->left->data, dst);
+            dst->left->size = src->left->size;
+            stack.push({src->left, dst->left});
+        }
+        if (src->right) {
+            dst->right = new Node(src->right->data, dst);
+            dst->right->size = src->right->size;
+            stack.push({src->right, dst->right});
+        }
+    }
+    return new_root;
 }
 
 template<typename T>
@@ -128,178 +240,190 @@ MyBST<T> &MyBST<T>::operator=(const MyBST<T> &other) {
 
 
 template <typename T> // 时间复杂度为 O(h), h为树的高度
-typename MyBST<T>::Node* MyBST<T>::_insert(Node* node, const T& value) {
-    // 1. 基本情况：找到了插入位置 (当前节点为空)
-    if (node == nullptr) {
-        // 创建一个新节点并返回它的地址
-        return new Node(value);
+void MyBST<T>::insert(const T& value) {
+    // 1. 沿着搜索路径找到插入位置 (一个空的孩子指针)
+    Node* parent = nullptr;
+    Node** link = &_root;
+    while (*link != nullptr) {
+        parent = *link;
+        if (value < parent->data) {
+            link = &parent->left;
+        } else if (value > parent->data) {
+            link = &parent->right;
+        } else {
+            return; // 如果 value == node->data，我们什么都不做
+        }
     }
 
-    // 2. 递归步骤
-    if (value < node->data) {
-        // 去左子树继续寻找
-        node->left = _insert(node->left,value);
-    } else if (value > node->data) {
-        // 去右子树继续寻找
-        node->right = _insert(node->right,value);
+    // 2. 挂上新节点，再沿 parent 回溯，路径上每个祖先的 size 都加一
+    *link = new Node(value, parent);
+    for (Node* node = parent; node != nullptr; node = node->parent) {
+        node->size++;
     }
-    // 如果 value == node->data，我们什么都不做，直接返回原节点
-
-    // 更新 size
-    node->size = 1 + (node->left ? node->left->size : 0) + (node->right ? node->right->size : 0);
-
-    // 3. 返回当前节点（可能它的 left 或 right 已经被更新）
-    // 实际是树的更新
-    return node;
-}
-
-
-template <typename T>
-void MyBST<T>::insert(const T& value) {
-    // 注意空树情况
-    _root = _insert(_root,value);
 }
 
 template <typename T>
 // 对于平衡的树，有 N / 2^ h = 1 (即分到最小就是1), 其高度大约为log(N), 则复杂度为 O(logN)
 // 对于不平衡的树，最差情况为退化为一个链表，则高度为N, 复杂度为 O(N)
-bool MyBST<T>::_find(Node *node, const T &value) const {
-    if (node == nullptr) {// 1. 基本情况1：没找到 (当前节点为空)
-        return false;
-    }
-
-    if (value == node->data) {// 2. 基本情况2：找到了！
-        return true;
-    }
-
-    // 3. 递归步骤
-    if (value < node->data) {// 去左子树继续寻找
-        return _find(node->left, value);
-    }else {// 去右子树继续寻找
-        return _find(node->right, value);
+typename MyBST<T>::Node *MyBST<T>::_find_node(const T &value) const {
+    Node* node = _root;
+    while (node != nullptr) {
+        if (value == node->data) {// 找到了！
+            return node;
+        }
+        // 去左子树或右子树继续寻找
+        node = value < node->data ? node->left : node->right;
     }
+    return nullptr;
 }
 
 template<typename T>
 bool MyBST<T>::find(const T &value) const {
-    return _find(_root, value);
-}
-
-template<typename T>
-void MyBST<T>::_inorder(Node *node, std::function<void(const T &)> func) const {
-    if (node == nullptr) return;
-
-    // 遵循“左 -> 根 -> 右”的顺序
-    // 1. 递归访问左子树
-    _inorder(node->left, func);
-
-    // 2. 访问根节点 (调用 func)
-    func(node->data);
-
-    // 3. 递归访问右子树
-    _inorder(node->right, func);
-}
-
-template<typename T>
-void MyBST<T>::_preorder(Node *node, std::function<void(const T &)> func) const {
-    if (node == nullptr) return;
-
-    // 遵循“根 -> 左 -> 右”的顺序
-    // 1. 访问根节点 (调用 func)
-    func(node->data);
-
-    // 2. 递归访问左子树
-    _preorder(node->left, func);
-
-    // 3. 递归访问右子树
-    _preorder(node->right, func);
-}
-
-template<typename T>
-void MyBST<T>::_postorder(Node *node, std::function<void(const T &)> func) const {
-    if (node == nullptr) return;
-
-    // 遵循“左 -> 右 -> 根”的顺序
-    // 1. 递归访问左子树
-    _postorder(node->left, func);
-
-    // 2. 递归访问右子树
-    _postorder(node->right, func);
-
-    // 3. 访问根节点 (调用 func)
-    func(node->data);
+    return _find_node(value) != nullptr;
 }
 
 template <typename T>
-void MyBST<T>::inorder(std::function<void(const T&)> func) const {
-    _inorder(_root, func);
+template <typename Visitor>
+void MyBST<T>::visit_inorder(Visitor&& visit) const {
+    // 遵循“左 -> 根 -> 右”的顺序：一路向左压栈，弹出时访问，再转向右子树
+    WalkStack stack;
+    const Node* node = _root;
+    while (node != nullptr || !stack.empty()) {
+        while (node != nullptr) {
+            stack.push(node);
+            node = node->left;
+        }
+        node = stack.top();
+        stack.pop();
+        visit(node->data);
+        node = node->right;
+    }
 }
 
 template <typename T>
-void MyBST<T>::preorder(std::function<void(const T&)> func) const {
-    _preorder(_root, func);
+template <typename Visitor>
+void MyBST<T>::visit_preorder(Visitor&& visit) const {
+    // 遵循“根 -> 左 -> 右”的顺序：先压右子树再压左子树，左子树就会先被弹出
+    if (_root == nullptr) return;
+    WalkStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const Node* node = stack.top();
+        stack.pop();
+        visit(node->data);
+        if (node->right) stack.push(node->right);
+        if (node->left) stack.push(node->left);
+    }
 }
 
 template <typename T>
-void MyBST<T>::postorder(std::function<void(const T&)> func) const {
-    _postorder(_root, func);
+template <typename Visitor>
+void MyBST<T>::visit_postorder(Visitor&& visit) const {
+    // 遵循“左 -> 右 -> 根”的顺序：栈顶节点的右子树还没走过就先去右边，走过了 (或没有) 才访问它
+    WalkStack stack;
+    const Node* node = _root;
+    const Node* last_visited = nullptr;
+    while (node != nullptr || !stack.empty()) {
+        if (node != nullptr) {
+            stack.push(node);
+            node = node->left;
+            continue;
+        }
+        const Node* top = stack.top();
+        if (top->right != nullptr && top->right != last_visited) {
+            node = top->right;
+        }
+        else {
+            visit(top->data);
+            last_visited = top;
+            stack.pop();
+        }
+    }
 }
 
 template<typename T>
-// 找到第一个不小于 value 的值
-typename MyBST<T>::Node *MyBST<T>::_lower_bound(Node *node, const T &value) const {
-    if (node == nullptr) {
-        return nullptr;
+// 找到第一个不小于 value 的值：往左走之前记下当前节点，它是目前为止最好的候选
+typename MyBST<T>::Node *MyBST<T>::lower_bound(const T &value) const {
+    Node* result = nullptr;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (!(node->data < value)) {
+            result = node;
+            node = node->left;
+        }
+        else {
+            node = node->right;
+        }
     }
+    return result;
+}
 
-    if (!(node->data < value)) {
-        Node* left_result = _lower_bound(node->left, value);
-        if (left_result != nullptr) {
-            return left_result;
+template<typename T>
+// 找到第一个严格大于 value 的值
+typename MyBST<T>::Node *MyBST<T>::upper_bound(const T &value) const {
+    Node* result = nullptr;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (value < node->data) {
+            result = node;
+            node = node->left;
+        }
+        else {
+            node = node->right;
         }
-        else return node;
-    }
-    else {
-        return _lower_bound(node->right, value);
     }
+    return result;
 }
 
 template<typename T>
-// 找到第一个不小于 value 的值
-typename MyBST<T>::Node *MyBST<T>::lower_bound(const T &value) const {
-    return _lower_bound(_root,value);
+typename MyBST<T>::Node *MyBST<T>::_find_min(Node *node) {
+    if (node == nullptr) return nullptr;
+    while (node->left != nullptr) {
+        node = node->left;
+    }
+    return node;
 }
 
 template<typename T>
-// 找到第一个严格大于 value 的值
-typename MyBST<T>::Node *MyBST<T>::_upper_bound(Node *node, const T &value) const {
-    if (node == nullptr) {
-        return nullptr;
+typename MyBST<T>::Node *MyBST<T>::_find_max(Node *node) {
+    if (node == nullptr) return nullptr;
+    while (node->right != nullptr) {
+        node = node->right;
     }
+    return node;
+}
 
-    if (value < node->data) {
-        Node* left_result = _upper_bound(node->left, value);
-        if (left_result != nullptr) {
-            return left_result;
-        }
-        else return node;
+template<typename T>
+// 中序后继：有右子树就是右子树的最小值；否则往上爬，直到自己是某个祖先左子树里的节点
+const typename MyBST<T>::Node *MyBST<T>::_successor(const Node *node) {
+    if (node->right != nullptr) return _find_min(node->right);
+    const Node* parent = node->parent;
+    while (parent != nullptr && node == parent->right) {
+        node = parent;
+        parent = parent->parent;
     }
-    else return _upper_bound(node->right, value);
+    return parent;
 }
 
 template<typename T>
-// 找到第一个严格大于 value 的值
-typename MyBST<T>::Node *MyBST<T>::upper_bound(const T &value) const {
-    return _upper_bound(_root, value);
+// 中序前驱：与后继对称
+const typename MyBST<T>::Node *MyBST<T>::_predecessor(const Node *node) {
+    if (node->left != nullptr) return _find_max(node->left);
+    const Node* parent = node->parent;
+    while (parent != nullptr && node == parent->left) {
+        node = parent;
+        parent = parent->parent;
+    }
+    return parent;
 }
 
 template<typename T>
-typename MyBST<T>::Node *MyBST<T>::_find_min(Node *node) const {
-    if (node == nullptr) return nullptr;
-    while (node->left != nullptr) {
-        node = node->left;
-    }
-    return node;
+void MyBST<T>::_replace_child(Node *node, Node *child) {
+    Node* parent = node->parent;
+    if (parent == nullptr) _root = child;
+    else if (parent->left == node) parent->left = child;
+    else parent->right = child;
+    if (child != nullptr) child->parent = parent;
 }
 
 /*       50                     (1. 找到后继 S=60)
@@ -315,14 +439,14 @@ typename MyBST<T>::Node *MyBST<T>::_find_min(Node *node) const {
 
           60  <--- S(60)的数据被拷贝到D(50)的位置
          /  \
-       30   80 <--- (3. 现在问题变成在右子树中删除60)
+       30   80 <--- (3. 现在问题变成摘掉原来的 S，它没有左孩子)
            /  \
           60   90
            \
             70
 
             |
-            V (递归删除后，60被其子节点70替代)
+            V (S 被它的右孩子 70 替代)
 
            60
          /  \
@@ -332,52 +456,28 @@ typename MyBST<T>::Node *MyBST<T>::_find_min(Node *node) const {
 */
 
 template<typename T>
-// _remove 函数应该返回经过删除操作后，这棵（子）树的新的根节点指针，用来维护整棵树。
-typename MyBST<T>::Node *MyBST<T>::_remove(Node *node, const T &value) {
+void MyBST<T>::remove(const T &value) {
+    Node* node = _find_node(value);
     if (node == nullptr) {
-        return nullptr;
-    }
-
-    if (value < node->data) {
-        node->left = _remove(node->left,value);
-    }
-    else if (value > node->data){
-        node->right = _remove(node->right,value);
+        return;
     }
 
-    else{
-        // 叶情况
-        if (node->left == nullptr && node->right == nullptr) {
-            delete node;
-            return nullptr;
-        }
-        // 有一棵子树的情况
-        else if (node->left != nullptr && node->right == nullptr){
-            Node* temp = node->left;
-            delete node;
-            return temp;
-        }
-        else if (node->left == nullptr && node->right != nullptr) {
-            Node* temp = node->right;
-            delete node;
-            return temp;
-        }
-        // 有两棵子树的情况，需要找到中序后继，再递归删除
-        else {
-            Node* successor = _find_min(node->right);
-            node->data = successor->data;
-            node->right = _remove(node->right, successor->data);
-        }
+    // 有两棵子树的情况：把中序后继的数据拷贝过来，真正摘掉的是后继
+    if (node->left != nullptr && node->right != nullptr) {
+        Node* successor = _find_min(node->right);
+        node->data = successor->data;
+        node = successor;
     }
-    // 更新 size
-    node->size = 1 + (node->left ? node->left->size : 0) + (node->right ? node->right->size : 0);
 
-    return node;
-}
+    // 现在 node 最多只有一棵子树 (叶子或单孩子)，用那棵子树顶替它
+    Node* child = node->left != nullptr ? node->left : node->right;
+    _replace_child(node, child);
 
-template<typename T>
-void MyBST<T>::remove(const T &value) {
-    _root = _remove(_root, value);
+    // 更新 size：被摘掉节点的所有祖先都少了一个后代
+    for (Node* ancestor = node->parent; ancestor != nullptr; ancestor = ancestor->parent) {
+        ancestor->size--;
+    }
+    delete node;
 }
 
 template<typename T>
@@ -402,6 +502,22 @@ bool MyBST<T>::empty() const {
     return _root == nullptr;
 }
 
+template<typename T>
+int MyBST<T>::height() const {
+    // 同样用显式的栈，退化成链表的树也能算
+    MySmallStack<std::pair<const Node*, int>, 32> stack;
+    int result = 0;
+    if (_root) stack.push({_root, 1});
+    while (!stack.empty()) {
+        std::pair<const Node*, int> top = stack.top();
+        stack.pop();
+        if (top.second > result) result = top.second;
+        if (top.first->left) stack.push({top.first->left, top.second + 1});
+        if (top.first->right) stack.push({top.first->right, top.second + 1});
+    }
+    return result;
+}
+
 template<typename T>
 T *MyBST<T>::find_value(const T &value_to_find) const {
     Node* node = lower_bound(value_to_find);
@@ -413,5 +529,89 @@ T *MyBST<T>::find_value(const T &value_to_find) const {
     return nullptr;
 }
 
-#endif
+template<typename T>
+T *MyBST<T>::select(size_t k) const {
+    Node* node = _root;
+    while (node != nullptr) {
+        size_t left_size = node->left ? node->left->size : 0;
+        if (k < left_size) {
+            node = node->left;
+        }
+        else if (k == left_size) {
+            return &(node->data);
+        }
+        else {
+            // 跳过左子树和当前节点
+            k -= left_size + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+size_t MyBST<T>::rank(const T &value) const {
+    size_t result = 0;
+    Node* node = _root;
+    while (node != nullptr) {
+        if (node->data < value) {
+            // 当前节点和它的整棵左子树都小于 value
+            result += 1 + (node->left ? node->left->size : 0);
+            node = node->right;
+        }
+        else {
+            node = node->left;
+        }
+    }
+    return result;
+}
+
+template<typename T>
+size_t MyBST<T>::count_in_range(const T &lo, const T &hi) const {
+    if (!(lo < hi)) return 0;
+    return rank(hi) - rank(lo);
+}
+
+template<typename T>
+MyIteratorRange<typename MyBST<T>::const_iterator> MyBST<T>::range(const T &lo, const T &hi) const {
+    if (!(lo < hi)) return {end(), end()};
+    return {const_iterator(lower_bound(lo), this), const_iterator(lower_bound(hi), this)};
+}
+
+template<typename T>
+template<typename Visitor>
+void MyBST<T>::for_each_in_range(const T &lo, const T &hi, Visitor &&visit) const {
+    for (const T& value : range(lo, hi)) {
+        if (!my_range_visit(visit, value)) return;
+    }
+}
+
+template<typename T>
+template<typename ForwardIt>
+typename MyBST<T>::Node *MyBST<T>::_build_balanced(size_t n, ForwardIt &it, ForwardIt last, Node *parent) {
+    // 建出来的树是平衡的，递归深度只有 log2(n) 层
+    if (n == 0) return nullptr;
+    size_t left_size = n / 2;
+    Node* left = _build_balanced(left_size, it, last, nullptr);
+
+    Node* node = new Node(*it, parent);
+    do { ++it; } while (it != last && !(node->data < *it)); // 跳过重复的元素
+
+    node->left = left;
+    if (left) left->parent = node;
+    node->right = _build_balanced(n - 1 - left_size, it, last, node);
+    node->size = n;
+    return node;
+}
 
+template<typename T>
+template<typename ForwardIt>
+void MyBST<T>::build_from_sorted(ForwardIt first, ForwardIt last) {
+    size_t n = my_count_sorted_unique(first, last);
+    // 先建好新树再释放旧树：[first, last) 可以就是这棵树自己的迭代器
+    Node* new_root = _build_balanced(n, first, last, nullptr);
+    _destroy_tree(_root);
+    _root = new_root;
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef MYCONCURRENTHASHMAP_H
+#define MYCONCURRENTHASHMAP_H
+
+#include "MyHashMap.h"   // 每个分片内部就是一个普通的 MyHashMap
+#include <cstddef>
+#include <cstdint>
+#include <functional>    // 需要 std::hash
+#include <mutex>         // std::unique_lock
+#include <shared_mutex>  // std::shared_mutex, std::shared_lock
+
+/*
+ * MyConcurrentHashMap: 分片加锁的线程安全哈希表
+ *
+ * 用一把全局锁包住 MyHashMap 时，所有线程都在抢同一把锁，核数一多就完全串行化了。
+ * 这里把 key 按哈希值分散到 N 个相互独立的分片 (shard) 上，每个分片有自己的读写锁：
+ *   - 不同分片上的操作完全并行；
+ *   - 同一分片上的读操作 (find / contains) 持有共享锁，也可以并行；
+ *   - 写操作 (insert / erase / upsert) 持有独占锁。
+ *
+ * 因为别的线程随时可能修改或删除元素，这里不能像 MyHashMap 一样返回指向 value 的指针：
+ *   - find 把 value 拷贝到调用方提供的变量里；
+ *   - 需要“读-改-写”的场景使用 upsert / update，回调函数在锁内执行，保证原子性。
+ */
+template <typename K, typename V>
+class MyConcurrentHashMap {
+private:
+    // 每个分片独占一条缓存行，避免相邻分片的锁之间出现伪共享 (false sharing)
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        MyHashMap<K, V> map;
+    };
+
+    Shard* _shards;
+    size_t _shard_count; // 2 的幂
+
+    // 用哈希值的高位选择分片，低位留给分片内部的 MyHashMap 选桶，两者互不干扰
+    Shard& _shard_for(const K& key) const {
+        uint64_t h = static_cast<uint64_t>(std::hash<K>{}(key));
+        h *= 0x9E3779B97F4A7C15ULL;
+        return _shards[static_cast<size_t>(h >> 40) & (_shard_count - 1)];
+    }
+
+public:
+    explicit MyConcurrentHashMap(size_t shard_count = 64) {
+        size_t count = 1;
+        while (count < shard_count) count <<= 1;
+        _shard_count = count;
+        _shards = new Shard[_shard_count];
+    }
+    ~MyConcurrentHashMap() { delete[] _shards; }
+
+    // 锁不能拷贝，整个并发容器也不允许拷贝
+    MyConcurrentHashMap(const MyConcurrentHashMap&) = delete;
+    MyConcurrentHashMap& operator=(const MyConcurrentHashMap&) = delete;
+
+    // 插入或覆盖
+    void insert(const K& key, const V& value) {
+        Shard& shard = _shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map.insert(key, value);
+    }
+
+    // 找到时把 value 拷贝到 out 并返回 true
+    bool find(const K& key, V& out) const {
+        const Shard& shard = _shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const V* value = shard.map.find(key);
+        if (value == nullptr) return false;
+        out = *value;
+        return true;
+    }
+
+    bool contains(const K& key) const {
+        const Shard& shard = _shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.map.find(key) != nullptr;
+    }
+
+    bool erase(const K& key) {
+        Shard& shard = _shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.map.erase(key);
+    }
+
+    // 原子的“读-改-写”：key 不存在时先插入 V()，然后在锁内调用 func(value)。
+    // 返回 true 表示这次调用新插入了 key。
+    template <typename F>
+    bool upsert(const K& key, F&& func) {
+        Shard& shard = _shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        size_t before = shard.map.size();
+        V& value = shard.map[key];
+        func(value);
+        return shard.map.size() != before;
+    }
+
+    // 只更新已存在的 key：找到时在锁内调用 func(value) 并返回 true
+    template <typename F>
+    bool update(const K& key, F&& func) {
+        Shard& shard = _shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        V* value = shard.map.find(key);
+        if (value == nullptr) return false;
+        func(*value);
+        return true;
+    }
+
+    // 逐个分片加共享锁求和；并发修改时得到的是一个近似的快照
+    size_t size() const {
+        size_t total = 0;
+        for (size_t i = 0; i < _shard_count; ++i) {
+            std::shared_lock<std::shared_mutex> lock(_shards[i].mutex);
+            total += _shards[i].map.size();
+        }
+        return total;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_t shard_count() const { return _shard_count; }
+};
+
+#endif
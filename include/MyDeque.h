@@ -1,10 +1,26 @@
 #ifndef MYDEQUE_H
 #define MYDEQUE_H
 
-#include <cstddef> // For size_t
+#include <algorithm> // std::max
+#include <cstddef>   // For size_t, std::ptrdiff_t
+#include <iterator>  // std::random_access_iterator_tag
+#include <new>       // ::operator new / placement new
+#include <utility>   // std::swap
+
+/*
+ * 每个数据块 (“车厢”) 的容量默认按字节预算计算：大约 512 字节，至少 8 个元素。
+ * 块太小 (例如固定 8 个 int = 32 字节) 时，每 8 个元素就要分配一次内存，遍历时也要频繁换块；
+ * 512 字节时 int 的块能放 128 个元素。需要时可以显式指定：MyDeque<T, 1024>。
+ */
+template <typename T>
+constexpr size_t my_deque_default_block_size() {
+    return 512 / sizeof(T) < 8 ? 8 : 512 / sizeof(T);
+}
 
-template<typename T>
+template<typename T, size_t BlockSize = my_deque_default_block_size<T>()>
 class MyDeque {
+    static_assert(BlockSize >= 2, "MyDeque needs at least 2 elements per block");
+
 public:
     // --- Typedefs ---
     using value_type = T;
@@ -15,21 +31,118 @@ public:
     using size_type = size_t;
 
     // --- Iterator ---
-    // 迭代器是 MyDeque 的核心部分，它需要知道如何在不同的数据块之间跳转
-    struct iterator {
+    // 迭代器是 MyDeque 的核心部分，它需要知道如何在不同的数据块之间跳转。
+    // 这是一个完整的随机访问迭代器，可以直接用于 std::sort、std::lower_bound 和 range-for。
+    // Ref / Ptr 决定它是 iterator 还是 const_iterator。
+    // 注意：push_front / push_back 可能重新分配中控数组，之后原有的迭代器全部失效 (元素本身不会移动)
+    template <typename Ref, typename Ptr>
+    struct _Iterator {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
         T *_current; // 指向当前元素
         T *_first; // 指向当前数据块的头部
         T *_last; // 指向当前数据块的尾部 (最后一个元素的下一个位置)
         T **_map_node; // 指向中控数组中，管理着当前数据块的那个指针
 
-        // 后续我们将在这里实现迭代器的各种操作 (++, --, *, ->, ==, !=)
-        void set_new_node(T **new_map_node);
+        _Iterator() : _current(nullptr), _first(nullptr), _last(nullptr), _map_node(nullptr) {}
+
+        // iterator 可以隐式转换成 const_iterator (对 iterator 自己来说这就是拷贝构造)
+        _Iterator(const _Iterator<T&, T*>& other)
+            : _current(other._current), _first(other._first), _last(other._last), _map_node(other._map_node) {}
+        _Iterator& operator=(const _Iterator&) = default;
+
+        // 当你告诉迭代器一个新的 _map_node 位置时，它负责更新自己的 _first, _last, 和 _current 指针到新“车厢”的正确位置。
+        void set_new_node(T **new_map_node) {
+            _map_node = new_map_node;
+            _first = *new_map_node;
+            _last = _first + BLOCK_SIZE;
+            _current = _first;
+        }
+
+        Ref operator*() const { return *_current; }
+        Ptr operator->() const { return _current; }
+        Ref operator[](difference_type n) const { return *(*this + n); }
+
+        _Iterator& operator++() {
+            ++_current;
+            if (_current == _last) { // 走出当前车厢，换到下一节的开头
+                set_new_node(_map_node + 1);
+            }
+            return *this;
+        }
+        _Iterator operator++(int) {
+            _Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        _Iterator& operator--() {
+            if (_current == _first) { // 已经在车厢开头，换到上一节的末尾
+                set_new_node(_map_node - 1);
+                _current = _last;
+            }
+            --_current;
+            return *this;
+        }
+        _Iterator operator--(int) {
+            _Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        // 跳跃 n 步：目标还在当前车厢里就直接移动指针，否则先算出要跨几节车厢，一次跳过去
+        _Iterator& operator+=(difference_type n) {
+            const difference_type block = static_cast<difference_type>(BLOCK_SIZE);
+            const difference_type offset = n + (_current - _first);
+            if (offset >= 0 && offset < block) {
+                _current += n;
+            }
+            else {
+                const difference_type node_offset = offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+                set_new_node(_map_node + node_offset);
+                _current = _first + (offset - node_offset * block);
+            }
+            return *this;
+        }
+        _Iterator& operator-=(difference_type n) { return *this += -n; }
+
+        friend _Iterator operator+(_Iterator it, difference_type n) { return it += n; }
+        friend _Iterator operator+(difference_type n, _Iterator it) { return it += n; }
+        friend _Iterator operator-(_Iterator it, difference_type n) { return it -= n; }
+
+        // 两个迭代器之间的距离：中间的整节车厢 + 两头车厢里的零头
+        friend difference_type operator-(const _Iterator& a, const _Iterator& b) {
+            return static_cast<difference_type>(BLOCK_SIZE) * (a._map_node - b._map_node - 1)
+                + (a._current - a._first) + (b._last - b._current);
+        }
+
+        friend bool operator==(const _Iterator& a, const _Iterator& b) { return a._current == b._current; }
+        friend bool operator!=(const _Iterator& a, const _Iterator& b) { return a._current != b._current; }
+        friend bool operator<(const _Iterator& a, const _Iterator& b) {
+            return a._map_node == b._map_node ? a._current < b._current : a._map_node < b._map_node;
+        }
+        friend bool operator>(const _Iterator& a, const _Iterator& b) { return b < a; }
+        friend bool operator<=(const _Iterator& a, const _Iterator& b) { return !(b < a); }
+        friend bool operator>=(const _Iterator& a, const _Iterator& b) { return !(a < b); }
     };
 
+    using iterator = _Iterator<T&, T*>;
+    using const_iterator = _Iterator<const T&, const T*>;
+
 
     MyDeque();
+    MyDeque(const MyDeque& other);
+    MyDeque& operator=(const MyDeque& other);
+    MyDeque(MyDeque&& other) noexcept;
+    MyDeque& operator=(MyDeque&& other) noexcept;
     ~MyDeque();
 
+    void swap(MyDeque& other) noexcept;
+
     // --- Public Interface ---
     // 后续我们将在这里实现 push_back, push_front, pop_back, pop_front, operator[] 等函数
 
@@ -45,74 +158,214 @@ public:
     const T& back() const;  // const 版本
 
     T&operator[](size_type index);
+    const T& operator[](size_type index) const;
 
     size_t size() const;
     bool empty() const;
 
+    iterator begin() { return _start; }
+    iterator end() { return _finish; }
+    const_iterator begin() const { return _start; }
+    const_iterator end() const { return _finish; }
+    const_iterator cbegin() const { return _start; }
+    const_iterator cend() const { return _finish; }
+
+    // 分段遍历：对每节车厢里连续的那一段元素调用 func(first, last)，[first, last) 是普通指针区间。
+    // 热点循环写在 func 里就是对连续内存的紧凑内层循环，不需要每一步都检查是否要换车厢。
+    template <typename Func>
+    void for_each_segment(Func func);
+    template <typename Func>
+    void for_each_segment(Func func) const;
+
+    static constexpr size_t block_size() { return BlockSize; }
+
+    // 缓存中的空闲数据块个数
+    size_t spare_blocks() const { return _spare_count; }
+
+    // 释放缓存中的空闲数据块
+    void shrink_to_fit();
+
 private:
     // --- Member Variables ---
     T **_map; // 中控数组（“动车组的编组图”）
     size_t _map_size; // 中控数组的大小
-    static const size_t BLOCK_SIZE = 8;
+    static constexpr size_t BLOCK_SIZE = BlockSize;
 
     iterator _start; // 指向第一个元素的迭代器（“第一位乘客”）
     iterator _finish; // 指向最后一个元素下一个位置的迭代器（“最后一个空位”）
 
+    // 空闲数据块缓存：一端的块被取空时不立刻释放，先留在这里，另一端需要新块时直接复用。
+    // 队列式的用法 (push_back + pop_front) 在稳定状态下因此不再分配 / 释放内存
+    static constexpr size_t MAX_SPARE_BLOCKS = 4;
+    T *_spare[MAX_SPARE_BLOCKS];
+    size_t _spare_count;
+
+    // 数据块只是一段未构造的原始内存，元素用 placement new 构造、显式析构
+    T* _element(size_type index) const; // 第 index 个元素的地址
+
+    T* _acquire_block();
+    void _recycle_block(T* block);
+
+    void _init_empty();
+    void _destroy_all();
     void _reallocate_map();
 };
 
 // 在 MyDeque.h 文件中，MyDeque 类的 } 之后
 
-template<typename T>
-MyDeque<T>::MyDeque() {
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::_init_empty() {
+    _spare_count = 0;
     _map_size = 16;
     _map = new T *[_map_size]; // T**
     for (size_t i = 0; i < _map_size; ++i) { _map[i] = nullptr; }
 
+    // 第一节车厢放在 map 中间，第一个元素放在车厢中间，两端都有空间可以直接 push
     size_t initial_node_index = _map_size / 2;
-    _map[initial_node_index] = new T[8]; // T*
+    _map[initial_node_index] = _acquire_block(); // T*
 
-    _start._map_node = &_map[initial_node_index]; // T**
-    _start._current = _map[initial_node_index] + 4; // T*
-    _start._first = _map[initial_node_index]; // T*
-    _start._last = _map[initial_node_index] + 8; // T*
+    _start.set_new_node(&_map[initial_node_index]);
+    _start._current = _start._first + BLOCK_SIZE / 2; // T*
+    _finish = _start;
+}
 
-    _finish._map_node = &_map[initial_node_index]; // T**
-    _finish._current = _map[initial_node_index] + 4; // T*
-    _finish._first = _map[initial_node_index]; // T*
-    _finish._last = _map[initial_node_index] + 8; // T*
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>::MyDeque() {
+    _init_empty();
 }
 
-template <typename T>
-MyDeque<T>::~MyDeque() {
-    // 检查 _map 是否为空指针，以防万一（比如对象被移动后）
-    if (_map) {
-        // 步骤1: 销毁所有被分配了的数据块
-        // 遍历范围是从第一个被使用的map节点到最后一个被使用的map节点
-        for (T** node = _start._map_node; node <= _finish._map_node; ++node) {
-            // *node 的类型是 T*，它指向一个数据块
-            // 我们使用 delete[] 来销毁这个数据块数组
-            delete[] *node;
-        }
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>::MyDeque(const MyDeque& other) {
+    _init_empty();
+    for (size_t i = 0, n = other.size(); i < n; ++i) {
+        push_back(other[i]);
+    }
+}
 
-        // 步骤2: 销毁中控数组本身
-        // _map 是通过 new T*[] 创建的，所以用 delete[]
-        delete[] _map;
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>& MyDeque<T, BlockSize>::operator=(const MyDeque& other) {
+    if (this != &other) {
+        MyDeque copy(other);
+        swap(copy);
     }
+    return *this;
 }
 
-template<typename T>
-//当你告诉迭代器一个新的 _map_node 位置时，它负责更新自己的 _first, _last, 和 _current 指针到新“车厢”的正确位置。
-void MyDeque<T>::iterator::set_new_node(T **new_map_node) {
-    _map_node = new_map_node;
-    _first = *new_map_node;
-    _last = _first + BLOCK_SIZE;
-    _current = _first;
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>::MyDeque(MyDeque&& other) noexcept
+    : _map(other._map), _map_size(other._map_size), _start(other._start), _finish(other._finish),
+      _spare_count(other._spare_count)
+{
+    for (size_t i = 0; i < _spare_count; ++i) _spare[i] = other._spare[i];
+    // 被移走的对象不再拥有任何内存，析构时什么也不做。
+    // _start / _finish 也要清空 (否则还指着已经交出去的数据块)，于是它是一个合法的空 deque：
+    // size() == 0、empty()，下一次 push 时再重新分配 (见 push_back / push_front)
+    other._map = nullptr;
+    other._map_size = 0;
+    other._start = iterator();
+    other._finish = iterator();
+    other._spare_count = 0;
 }
 
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>& MyDeque<T, BlockSize>::operator=(MyDeque&& other) noexcept {
+    if (this != &other) {
+        MyDeque moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::swap(MyDeque& other) noexcept {
+    std::swap(_map, other._map);
+    std::swap(_map_size, other._map_size);
+    std::swap(_start, other._start);
+    std::swap(_finish, other._finish);
+    std::swap(_spare, other._spare);
+    std::swap(_spare_count, other._spare_count);
+}
+
+template<typename T, size_t BlockSize>
+MyDeque<T, BlockSize>::~MyDeque() {
+    _destroy_all();
+}
+
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::_destroy_all() {
+    // 检查 _map 是否为空指针（对象被移动后）
+    if (!_map) return;
+
+    // 步骤1: 析构所有元素
+    while (!empty()) pop_front();
+
+    // 步骤2: 释放数据块。取空的块都已经回收，map 中只剩 _finish 所在的那一块
+    for (size_t i = 0; i < _map_size; ++i) {
+        ::operator delete(_map[i]);
+    }
+    shrink_to_fit();
+
+    // 步骤3: 销毁中控数组本身
+    delete[] _map;
+    _map = nullptr;
+}
+
+template<typename T, size_t BlockSize>
+T* MyDeque<T, BlockSize>::_acquire_block() {
+    if (_spare_count > 0) {
+        return _spare[--_spare_count];
+    }
+    return static_cast<T*>(::operator new(BLOCK_SIZE * sizeof(T)));
+}
+
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::_recycle_block(T* block) {
+    if (_spare_count < MAX_SPARE_BLOCKS) {
+        _spare[_spare_count++] = block;
+    }
+    else {
+        ::operator delete(block);
+    }
+}
+
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::shrink_to_fit() {
+    while (_spare_count > 0) {
+        ::operator delete(_spare[--_spare_count]);
+    }
+}
+
+template<typename T, size_t BlockSize>
+template <typename Func>
+void MyDeque<T, BlockSize>::for_each_segment(Func func) {
+    if (empty()) return;
+    if (_start._map_node == _finish._map_node) {
+        func(_start._current, _finish._current);
+        return;
+    }
+    // 头部车厢从 _start 到车厢末尾，中间是整节车厢，尾部车厢从开头到 _finish
+    func(_start._current, _start._last);
+    for (T** node = _start._map_node + 1; node < _finish._map_node; ++node) {
+        func(*node, *node + BLOCK_SIZE);
+    }
+    if (_finish._current != _finish._first) {
+        func(_finish._first, _finish._current);
+    }
+}
+
+template<typename T, size_t BlockSize>
+template <typename Func>
+void MyDeque<T, BlockSize>::for_each_segment(Func func) const {
+    const_cast<MyDeque*>(this)->for_each_segment([&func](T* first, T* last) {
+        func(static_cast<const T*>(first), static_cast<const T*>(last));
+    });
+}
+
+
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::push_back(const T& value) {
+    if (!_map) _init_empty(); // 被移走之后再次使用
 
-template <typename T>
-void MyDeque<T>::push_back(const T& value) {
     // 步骤1: 在当前 _finish 位置的 "座位" 上放入数据
     // 我们需要先为这个位置构造对象，而不是直接赋值，使用 placement new
     new (_finish._current) T(value);
@@ -131,8 +384,8 @@ void MyDeque<T>::push_back(const T& value) {
         // 1. 检查下一节 "车厢" 是否已经存在。
         //    *(_finish._map_node + 1) 就是下一节车厢的 T* 指针
         if (*(_finish._map_node + 1) == nullptr) {
-            // 如果不存在，就 new 一个新的数据块（车厢）并挂接上去
-            *(_finish._map_node + 1) = new T[BLOCK_SIZE];
+            // 如果不存在，就取一个数据块（车厢）挂接上去，优先复用缓存中的空闲块
+            *(_finish._map_node + 1) = _acquire_block();
         }
 
         // 2. 调用辅助函数，让 _finish 跳转到下一节车厢的开头
@@ -140,9 +393,11 @@ void MyDeque<T>::push_back(const T& value) {
     }
 }
 
-template <typename T>
+template<typename T, size_t BlockSize>
 // [start, finish)
-void MyDeque<T>::push_front(const T& value) {
+void MyDeque<T, BlockSize>::push_front(const T& value) {
+    if (!_map) _init_empty(); // 被移走之后再次使用
+
     // 检查是否需要在头部换车厢
     // 如果 _start 的当前位置就是块的开头
     if (_start._current == _start._first) {
@@ -153,7 +408,7 @@ void MyDeque<T>::push_front(const T& value) {
         }
 
         if (*(_start._map_node - 1) == nullptr) {
-            *(_start._map_node - 1) = new T[BLOCK_SIZE];
+            *(_start._map_node - 1) = _acquire_block();
         }
         _start.set_new_node(_start._map_node - 1);
         // 跳转后，将 _start 定位到新块的末尾
@@ -167,17 +422,20 @@ void MyDeque<T>::push_front(const T& value) {
     new (_start._current) T(value);
 }
 
-template <typename T>
+template<typename T, size_t BlockSize>
 // [first, last)
-void MyDeque<T>::pop_back() {
+void MyDeque<T, BlockSize>::pop_back() {
     if (empty()) { return; }
 
     if (_finish._current == _finish._first) {
         // 边界情况
         // 只需要处理换车厢，不需要扩容
-        // 我们也不释放内存块，以提高效率
+        // _finish 所在的这节车厢已经空了，摘下来放进空闲块缓存
+        T** empty_node = _finish._map_node;
         _finish.set_new_node(_finish._map_node - 1);
         _finish._current = _finish._last;
+        _recycle_block(*empty_node);
+        *empty_node = nullptr;
     }
 
     // _finish.current 一定无元素，但他的前一个一定有元素
@@ -185,9 +443,9 @@ void MyDeque<T>::pop_back() {
     _finish._current->~T();
 }
 
-template<typename T>
+template<typename T, size_t BlockSize>
 // [first, last)
-void MyDeque<T>::pop_front() {
+void MyDeque<T, BlockSize>::pop_front() {
     if (empty()) { return; }
 
     // _start._current 一定有元素
@@ -197,23 +455,26 @@ void MyDeque<T>::pop_front() {
     if (_start._current == _start._last) {
         // 边界情况
         // 只需要处理换车厢，不需要扩容
-        // 我们也不释放内存块
+        // 离开的这节车厢已经空了，摘下来放进空闲块缓存
+        T** empty_node = _start._map_node;
         _start.set_new_node(_start._map_node + 1);
+        _recycle_block(*empty_node);
+        *empty_node = nullptr;
     }
 }
 
-template<typename T>
-T& MyDeque<T>::front() {
+template<typename T, size_t BlockSize>
+T& MyDeque<T, BlockSize>::front() {
     return *_start._current;
 }
 
-template<typename T>
-const T& MyDeque<T>::front() const {
+template<typename T, size_t BlockSize>
+const T& MyDeque<T, BlockSize>::front() const {
     return *_start._current;
 }
 
-template<typename T>
-T& MyDeque<T>::back() {
+template<typename T, size_t BlockSize>
+T& MyDeque<T, BlockSize>::back() {
     // 最后一个元素总是在 _finish 的前一个位置
     iterator temp = _finish;
     --temp._current;
@@ -226,8 +487,8 @@ T& MyDeque<T>::back() {
     return *temp._current;
 }
 
-template<typename T>
-const T& MyDeque<T>::back() const {
+template<typename T, size_t BlockSize>
+const T& MyDeque<T, BlockSize>::back() const {
     iterator temp = _finish;
     --temp._current;
     if (temp._current < temp._first) {
@@ -237,15 +498,25 @@ const T& MyDeque<T>::back() const {
     return *temp._current;
 }
 
-template<typename T>
-T& MyDeque<T>::operator[](size_type index) {
+template<typename T, size_t BlockSize>
+T& MyDeque<T, BlockSize>::operator[](size_type index) {
+    return *_element(index);
+}
+
+template<typename T, size_t BlockSize>
+const T& MyDeque<T, BlockSize>::operator[](size_type index) const {
+    return *_element(index);
+}
+
+template<typename T, size_t BlockSize>
+T* MyDeque<T, BlockSize>::_element(size_type index) const {
     // 1. 计算 _start 在其块内的偏移
     const size_type start_offset_in_block = _start._current - _start._first;
 
     // 2. 计算目标元素相对于 _start 所在块头部的总偏移, 补全前面方便计算
     const size_type total_offset = start_offset_in_block + index;
 
-    // 3. 计算目标元素在 map 中的节点索引 和 在块内的索引
+    // 3. 计算目标元素在 map 中的节点索引 和 在块内的索引 (BLOCK_SIZE 是编译期常量，2 的幂时就是移位和位与)
     const size_type target_map_node_offset = total_offset / BLOCK_SIZE;
     const size_type target_block_offset = total_offset % BLOCK_SIZE ;
 
@@ -253,18 +524,18 @@ T& MyDeque<T>::operator[](size_type index) {
     T** target_map_node = _start._map_node + target_map_node_offset;
     T* target_block = *target_map_node;
 
-    // 5. 返回目标元素的引用
-    return target_block[target_block_offset];
+    // 5. 返回目标元素的地址
+    return target_block + target_block_offset;
 }
 
-template<typename T>
-bool MyDeque<T>::empty() const {
+template<typename T, size_t BlockSize>
+bool MyDeque<T, BlockSize>::empty() const {
     return _start._current == _finish._current;
 }
 
 
-template <typename T>
-typename MyDeque<T>::size_type MyDeque<T>::size() const {
+template<typename T, size_t BlockSize>
+typename MyDeque<T, BlockSize>::size_type MyDeque<T, BlockSize>::size() const {
     // Case 1: 如果 _start 和 _finish 在同一个数据块中
     if (_start._map_node == _finish._map_node) {
         // 大小就是两个指针的直接距离
@@ -287,10 +558,31 @@ typename MyDeque<T>::size_type MyDeque<T>::size() const {
     }
 }
 
-template <typename T>
-void MyDeque<T>::_reallocate_map() {
-    // 步骤1: 创建一个通常是两倍大的新 map，并初始化为空
+template<typename T, size_t BlockSize>
+void MyDeque<T, BlockSize>::_reallocate_map() {
     const size_type old_num_nodes = _finish._map_node - _start._map_node + 1;
+
+    // 步骤0: 队列式的用法 (push_back + pop_front) 会让车厢整体向 map 的一端漂移，
+    // 这时 map 其实大半是空的。只要空位足够，就把现有车厢挪回中间，不再扩容
+    if (_map_size > 2 * (old_num_nodes + 1)) {
+        T** new_start_node = _map + (_map_size - old_num_nodes) / 2;
+        T** old_start_node = _start._map_node;
+        if (new_start_node < old_start_node) {
+            for (size_type i = 0; i < old_num_nodes; ++i) new_start_node[i] = old_start_node[i];
+        }
+        else {
+            for (size_type i = old_num_nodes; i > 0; --i) new_start_node[i - 1] = old_start_node[i - 1];
+        }
+        // 车厢之外的位置全部清空 (使用中的车厢之外本来就没有挂着数据块)
+        for (T** node = _map; node < new_start_node; ++node) *node = nullptr;
+        for (T** node = new_start_node + old_num_nodes; node < _map + _map_size; ++node) *node = nullptr;
+
+        _start._map_node = new_start_node;
+        _finish._map_node = new_start_node + old_num_nodes - 1;
+        return;
+    }
+
+    // 步骤1: 创建一个通常是两倍大的新 map，并初始化为空
     const size_type new_map_size = _map_size + std::max(_map_size, old_num_nodes) + 2;
     T** new_map = new T*[new_map_size];
     for (size_type i = 0; i < new_map_size; ++i) {
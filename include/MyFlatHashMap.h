@@ -0,0 +1,301 @@
+#ifndef MYFLATHASHMAP_H
+#define MYFLATHASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // 需要 std::hash
+#include "MyHash.h"     // my_hash_mix
+#include <new>         // placement new
+#include <utility>     // std::move, std::swap
+
+/*
+ * MyFlatHashMap: MyHashMap 的“开放寻址”版本 (Robin Hood Hashing)
+ *
+ * 与 MyHashMap 的区别：
+ *   MyHashMap 的每个桶是一条 MyLinkedList，查找要沿着堆上的节点一个个跳，插入要 new 一个节点。
+ *   MyFlatHashMap 把所有键值对直接放在一块连续的数组里，冲突时向后线性探测 (linear probing)。
+ *
+ * Robin Hood 规则：
+ *   每个元素记录自己离“理想位置”有多远 (探测距离)。插入时如果遇到一个比自己“更富” (距离更短) 的元素，
+ *   就把它的位置抢过来，让它继续往后找。这样所有元素的探测距离都很平均，查找失败时也能提前结束。
+ *
+ * 删除使用“反向移位” (backward-shift deletion)：
+ *   删除一个元素后，把后面那些不在理想位置上的元素依次往前挪一格，不需要墓碑 (tombstone) 标记。
+ *
+ * 接口和 MyHashMap 保持一致：insert / find / operator[] / erase / size / bucket_count。
+ */
+template <typename K, typename V>
+class MyFlatHashMap {
+private:
+    struct Slot {
+        K key;
+        V value;
+        Slot(const K& k, const V& v) : key(k), value(v) {}
+    };
+
+    Slot* _slots;         // 原始内存，只有 _dist[i] != 0 的位置上才真正构造了对象
+    uint32_t* _dist;      // 0 表示空槽，否则为 (探测距离 + 1)
+    size_t _capacity;     // 槽位数量，始终是 2 的幂，这样可以用 & 代替 %
+    size_t _size;
+
+    static constexpr double MAX_LOAD_FACTOR = 0.875; // Robin Hood 可以承受更高的负载因子
+
+    // 理想位置：先把 std::hash 的结果打散 (整数的 std::hash 通常就是它自己)，再取低位
+    size_t _home(const K& key) const {
+        return my_hash_mix(std::hash<K>{}(key)) & (_capacity - 1);
+    }
+
+    size_t _find_index(const K& key) const; // 找不到时返回 _capacity
+    size_t _insert_new(Slot&& slot);        // 插入一个确定不存在的 key，返回它最终所在的位置
+    void _rehash(size_t new_capacity);
+    void _allocate(size_t capacity);
+    void _release();
+
+public:
+    explicit MyFlatHashMap(size_t bucket_count = 16);
+    MyFlatHashMap(const MyFlatHashMap& other);
+    MyFlatHashMap& operator=(const MyFlatHashMap& other);
+    MyFlatHashMap(MyFlatHashMap&& other) noexcept;
+    MyFlatHashMap& operator=(MyFlatHashMap&& other) noexcept;
+    ~MyFlatHashMap() { _release(); }
+
+    void insert(const K& key, const V& value);
+    V& operator[](const K& key);
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    //根据 key 查找，如果找到了，返回一个指向 value 的指针；如果没找到，返回 nullptr。
+    V* find(const K& key);
+    const V* find(const K& key) const;
+
+    bool erase(const K& key);
+    void clear();
+
+    size_t bucket_count() const { return _capacity; }
+};
+
+template <typename K, typename V>
+void MyFlatHashMap<K, V>::_allocate(size_t capacity) {
+    // 容量向上取整到 2 的幂
+    size_t cap = 1;
+    while (cap < capacity) cap <<= 1;
+    _capacity = cap;
+    _slots = static_cast<Slot*>(::operator new(cap * sizeof(Slot)));
+    _dist = new uint32_t[cap](); // () 让所有距离初始化为 0，即全部为空槽
+}
+
+template <typename K, typename V>
+void MyFlatHashMap<K, V>::_release() {
+    if (_slots == nullptr) return;
+    for (size_t i = 0; i < _capacity; ++i) {
+        if (_dist[i] != 0) _slots[i].~Slot();
+    }
+    ::operator delete(_slots);
+    delete[] _dist;
+    _slots = nullptr;
+    _dist = nullptr;
+    _size = 0;
+}
+
+template <typename K, typename V>
+MyFlatHashMap<K, V>::MyFlatHashMap(size_t bucket_count)
+    : _slots(nullptr), _dist(nullptr), _capacity(0), _size(0)
+{
+    _allocate(bucket_count == 0 ? 1 : bucket_count);
+}
+
+template <typename K, typename V>
+MyFlatHashMap<K, V>::MyFlatHashMap(const MyFlatHashMap& other)
+    : _slots(nullptr), _dist(nullptr), _capacity(0), _size(0)
+{
+    _allocate(other._capacity == 0 ? 1 : other._capacity);
+    // 容量相同，所以每个元素可以原样拷贝到相同的位置 (other 被移动过时容量为 0，什么都不用拷贝)
+    for (size_t i = 0; i < other._capacity; ++i) {
+        if (other._dist[i] != 0) {
+            new (_slots + i) Slot(other._slots[i]);
+            _dist[i] = other._dist[i];
+        }
+    }
+    _size = other._size;
+}
+
+template <typename K, typename V>
+MyFlatHashMap<K, V>& MyFlatHashMap<K, V>::operator=(const MyFlatHashMap& other) {
+    if (this == &other) return *this;
+    MyFlatHashMap temp(other);
+    *this = std::move(temp);
+    return *this;
+}
+
+template <typename K, typename V>
+MyFlatHashMap<K, V>::MyFlatHashMap(MyFlatHashMap&& other) noexcept
+    : _slots(other._slots), _dist(other._dist), _capacity(other._capacity), _size(other._size)
+{
+    other._slots = nullptr;
+    other._dist = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+}
+
+template <typename K, typename V>
+MyFlatHashMap<K, V>& MyFlatHashMap<K, V>::operator=(MyFlatHashMap&& other) noexcept {
+    if (this == &other) return *this;
+    _release();
+    _slots = other._slots;
+    _dist = other._dist;
+    _capacity = other._capacity;
+    _size = other._size;
+    other._slots = nullptr;
+    other._dist = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    return *this;
+}
+
+template <typename K, typename V>
+size_t MyFlatHashMap<K, V>::_find_index(const K& key) const {
+    if (_capacity == 0) return _capacity;
+    const size_t mask = _capacity - 1;
+    size_t index = _home(key);
+    uint32_t dist = 1;
+
+    // Robin Hood 的不变性：如果当前槽位的距离比我们已经走过的距离还短 (包括空槽)，
+    // 说明 key 不可能在更后面，可以提前结束
+    while (_dist[index] >= dist) {
+        if (_dist[index] == dist && _slots[index].key == key) {
+            return index;
+        }
+        index = (index + 1) & mask;
+        ++dist;
+    }
+    return _capacity;
+}
+
+template <typename K, typename V>
+size_t MyFlatHashMap<K, V>::_insert_new(Slot&& slot) {
+    const size_t mask = _capacity - 1;
+    size_t index = _home(slot.key);
+    uint32_t dist = 1;
+    size_t result = _capacity; // 新 key 最终停留的位置
+
+    Slot carry(std::move(slot));
+    while (true) {
+        if (_dist[index] == 0) {
+            // 找到空槽：把手里的元素放下
+            new (_slots + index) Slot(std::move(carry));
+            _dist[index] = dist;
+            return result == _capacity ? index : result;
+        }
+        if (_dist[index] < dist) {
+            // 这个位置上的元素比我们“富”：抢占它的位置，让它继续往后找
+            std::swap(carry, _slots[index]);
+            std::swap(dist, _dist[index]);
+            if (result == _capacity) result = index; // 新 key 第一次落脚后就不会再被挪动
+        }
+        index = (index + 1) & mask;
+        ++dist;
+    }
+}
+
+template <typename K, typename V>
+void MyFlatHashMap<K, V>::_rehash(size_t new_capacity) {
+    Slot* old_slots = _slots;
+    uint32_t* old_dist = _dist;
+    size_t old_capacity = _capacity;
+
+    _allocate(new_capacity);
+
+    // 把旧表中的元素 *移动* 到新表，而不是拷贝
+    for (size_t i = 0; i < old_capacity; ++i) {
+        if (old_dist[i] != 0) {
+            _insert_new(std::move(old_slots[i]));
+            old_slots[i].~Slot();
+        }
+    }
+    ::operator delete(old_slots);
+    delete[] old_dist;
+}
+
+template <typename K, typename V>
+V* MyFlatHashMap<K, V>::find(const K& key) {
+    size_t index = _find_index(key);
+    return index == _capacity ? nullptr : &_slots[index].value;
+}
+
+template <typename K, typename V>
+const V* MyFlatHashMap<K, V>::find(const K& key) const {
+    size_t index = _find_index(key);
+    return index == _capacity ? nullptr : &_slots[index].value;
+}
+
+template <typename K, typename V>
+void MyFlatHashMap<K, V>::insert(const K& key, const V& value) {
+    size_t index = _find_index(key);
+    if (index != _capacity) {
+        // key 已存在，更新 value
+        _slots[index].value = value;
+        return;
+    }
+
+    // 先扩容再插入，保证新元素插入后的位置不会再因为 rehash 而改变
+    if (static_cast<double>(_size + 1) > _capacity * MAX_LOAD_FACTOR) {
+        _rehash(_capacity * 2);
+    }
+    _insert_new(Slot(key, value));
+    _size++;
+}
+
+template <typename K, typename V>
+V& MyFlatHashMap<K, V>::operator[](const K& key) {
+    size_t index = _find_index(key);
+    if (index != _capacity) {
+        return _slots[index].value;
+    }
+
+    if (static_cast<double>(_size + 1) > _capacity * MAX_LOAD_FACTOR) {
+        _rehash(_capacity * 2);
+    }
+    index = _insert_new(Slot(key, V()));
+    _size++;
+    return _slots[index].value;
+}
+
+template <typename K, typename V>
+bool MyFlatHashMap<K, V>::erase(const K& key) {
+    size_t index = _find_index(key);
+    if (index == _capacity) {
+        return false;
+    }
+
+    const size_t mask = _capacity - 1;
+    _slots[index].~Slot();
+    _dist[index] = 0;
+
+    // 反向移位：后面不在理想位置上的元素 (距离 > 1) 依次向前挪一格
+    size_t next = (index + 1) & mask;
+    while (_dist[next] > 1) {
+        new (_slots + index) Slot(std::move(_slots[next]));
+        _slots[next].~Slot();
+        _dist[index] = _dist[next] - 1;
+        _dist[next] = 0;
+        index = next;
+        next = (next + 1) & mask;
+    }
+
+    _size--;
+    return true;
+}
+
+template <typename K, typename V>
+void MyFlatHashMap<K, V>::clear() {
+    for (size_t i = 0; i < _capacity; ++i) {
+        if (_dist[i] != 0) {
+            _slots[i].~Slot();
+            _dist[i] = 0;
+        }
+    }
+    _size = 0;
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef MYHASH_H
+#define MYHASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>   // std::hash
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * 哈希表共用的哈希工具
+ *
+ * 1. my_hash_mix: 64 位“终结器” (finalizer，来自 MurmurHash3 的 fmix64)
+ *    整数的 std::hash 通常就是恒等映射，连续的 ID 直接取低位会非常集中。
+ *    先把所有位充分打散，再用 & (桶数 - 1) 取低位，就可以用位运算代替除法 (%)。
+ *
+ * 2. MyHash<K>: 哈希表默认使用的哈希函数，等价于 std::hash<K>。
+ *    对 std::string 做了特化，并声明 is_transparent，
+ *    这样 MyHashMap<std::string, V> 可以直接用 std::string_view / const char* 查找，
+ *    不需要先构造一个临时的 std::string。
+ *
+ * 3. my_is_transparent<T>: 判断哈希函数 / 比较函数是否支持异构查找。
+ *
+ * 4. my_prefetch: 软件预取。批量查找时先对所有目标地址发出预取，
+ *    多次缓存未命中的等待时间就可以重叠起来。编译器不支持时退化为空操作。
+ */
+
+inline size_t my_hash_mix(size_t hash) {
+    uint64_t h = static_cast<uint64_t>(hash);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+inline void my_prefetch(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, 0 /* 读 */, 3 /* 尽量留在各级缓存中 */);
+#else
+    (void)addr;
+#endif
+}
+
+template <typename K>
+struct MyHash {
+    size_t operator()(const K& key) const { return std::hash<K>{}(key); }
+};
+
+template <>
+struct MyHash<std::string> {
+    using is_transparent = void;
+
+    // 标准保证：内容相同的 std::string 和 std::string_view 哈希值相同
+    size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    size_t operator()(const std::string& key) const { return std::hash<std::string_view>{}(key); }
+    size_t operator()(const char* key) const { return std::hash<std::string_view>{}(key); }
+};
+
+template <typename T, typename = void>
+struct my_is_transparent : std::false_type {};
+
+template <typename T>
+struct my_is_transparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+#endif
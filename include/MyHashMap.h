@@ -3,9 +3,27 @@
 
 #include "MyVector.h"    // 我们将使用 MyVector 作为桶数组
 #include "MyLinkedList.h" // 每个桶是一个 MyLinkedList
-#include <functional>    // 需要 std::hash
-
-template <typename K, typename V>
+#include "MyIntrusiveList.h" // 或者一个侵入式链表 (MyIntrusiveBuckets)
+#include "MyHash.h"      // 默认哈希函数 MyHash 与打散函数 my_hash_mix
+#include <functional>    // 需要 std::equal_to
+#include <iterator>      // std::iterator_traits, std::distance
+#include <type_traits>
+#include <utility>       // std::move
+
+// 桶 (链表) 的两种实现，作为 MyHashMap 的 Buckets 参数
+struct MyListBuckets {};      // 每个桶是一个 MyLinkedList<Node>，节点由链表负责分配和释放
+struct MyIntrusiveBuckets {}; // 每个桶是一个 MyIntrusiveList<Node>，prev / next 直接嵌在 Node 里，
+                              // 节点由 MyHashMap 自己 new / delete，桶对象本身也更小
+
+/*
+ * 模板参数：
+ *   Hash     : 哈希函数，默认 MyHash<K> (即 std::hash<K>，std::string 额外支持 string_view 查找)
+ *   KeyEqual : key 的相等比较，默认 std::equal_to<> (透明比较，可以比较 std::string 和 std::string_view)
+ *   Buckets  : 桶的链表实现，MyListBuckets (默认) 或 MyIntrusiveBuckets
+ * 当 Hash 和 KeyEqual 都声明了 is_transparent 时，find 可以接受任何可以与 K 比较的类型 (异构查找)。
+ */
+template <typename K, typename V, typename Hash = MyHash<K>, typename KeyEqual = std::equal_to<>,
+          typename Buckets = MyListBuckets>
 class MyHashMap {
 private:
     // 1. 定义存储键值对的节点结构
@@ -22,178 +40,543 @@ private:
     // 这要求我们的 MyLinkedList 功能比较完善
 
     // 为了从零开始，我们自己定义Node，并让 MyLinkedList 存储 Node
-    struct Node {
+    // 侵入式模式下 Node 额外继承一个钩子，直接挂在 MyIntrusiveList 上
+    static constexpr bool _intrusive = std::is_same<Buckets, MyIntrusiveBuckets>::value;
+    struct NoHook {};
+
+    struct Node : std::conditional<_intrusive, MyIntrusiveHook<>, NoHook>::type {
         K key;
         V value;
-        // 注意：这个Node不需要next/prev，因为MyLinkedList会处理
-        Node(const K& k, const V& v) : key(k), value(v) {}
+        // 缓存打散后的完整哈希值：rehash 时直接用它算新桶下标，不需要再调用一次哈希函数；
+        // 查找时先比较哈希值，不相等就跳过 (对 std::string 这类比较代价高的 key 很有用)
+        size_t hash;
+        // 注意：这个Node不需要自己写next/prev，因为MyLinkedList (或者钩子) 会处理
+        Node(const K& k, const V& v, size_t h) : key(k), value(v), hash(h) {}
     };
 
-    MyVector<MyLinkedList<Node>> _buckets;
+    using Bucket = typename std::conditional<_intrusive, MyIntrusiveList<Node>, MyLinkedList<Node>>::type;
+
+    MyVector<Bucket> _buckets; // 桶数始终是 2 的幂
     size_t _size; // Map中总的键值对数量
+    Hash _hasher;
+    KeyEqual _key_equal;
+
+    // --- 渐进式 rehash (incremental rehash) ---
+    // 开启后，扩容时不再一次性搬完所有桶，而是让新旧两个桶数组同时存在，
+    // 之后的每次修改操作 (insert / operator[] / erase) 顺手搬迁 _rehash_step 个旧桶。
+    // 搬迁期间的查找需要同时检查两个桶数组：下标 >= _migrate_pos 的旧桶还没有搬走。
+    MyVector<Bucket> _old_buckets;
+    size_t _migrate_pos;   // 下一个要搬迁的旧桶下标
+    bool _incremental;     // 是否开启渐进式 rehash
+    size_t _rehash_step;   // 每次操作最多搬迁的旧桶数量
+
+    // 私有辅助函数：计算 key 打散后的哈希值，每次操作只算一次
+    template <typename Q>
+    size_t _hash_of(const Q& key) const {
+        return my_hash_mix(_hasher(key));
+    }
+
+    // 根据哈希值计算桶的索引：桶数是 2 的幂，用位与代替取模
+    static size_t _bucket_index(size_t hash, size_t bucket_count) {
+        return hash & (bucket_count - 1);
+    }
+
+    static size_t _round_up_pow2(size_t n) {
+        size_t count = 1;
+        while (count < n) count <<= 1;
+        return count;
+    }
+
+    // 在新表 (以及尚未搬迁的旧桶) 中查找 key 所在的节点，hash 是 _hash_of(key)
+    template <typename Q>
+    Node* _find_node(const Q& key, size_t hash) const;
+
+    // 在单个桶中查找，找到时返回指向该节点的迭代器，否则返回 end()
+    template <typename Q>
+    typename Bucket::iterator _find_in_bucket(Bucket& bucket, const Q& key, size_t hash) const {
+        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+            const Node& node = *it;
+            if (node.hash == hash && _key_equal(node.key, key)) {
+                return it;
+            }
+        }
+        return bucket.end();
+    }
+
+    // 只有 Hash 和 KeyEqual 都是透明的时候，才开放异构查找
+    template <typename H, typename E>
+    using _enable_if_transparent =
+        typename std::enable_if<my_is_transparent<H>::value && my_is_transparent<E>::value>::type;
+
+    bool _is_rehashing() const { return !_old_buckets.empty(); }
+    void _rehash_step_once();  // 搬迁最多 _rehash_step 个旧桶
+    void _finish_rehash();     // 把剩余的旧桶全部搬完
 
-    // 私有辅助函数：根据 key 计算桶的索引
-    size_t _get_bucket_index(const K& key) const {
-        // 使用C++标准库提供的 std::hash
-        std::hash<K> hasher;
-        return hasher(key) % _buckets.size();
+    double _max_load_factor; // 最大负载因子 (Load Factor)，默认 0.75
+
+    bool _over_load(size_t size, size_t bucket_count) const {
+        return static_cast<double>(size) / bucket_count > _max_load_factor;
+    }
+    // 两种桶的差异只在节点的创建和销毁上
+    Node& _bucket_push(Bucket& bucket, const K& key, const V& value, size_t hash) {
+        if constexpr (_intrusive) {
+            Node* node = new Node(key, value, hash);
+            bucket.push_back(*node);
+            return *node;
+        }
+        else {
+            bucket.push_back(Node(key, value, hash));
+            return bucket.back();
+        }
     }
 
-    static constexpr double MAX_LOAD_FACTOR = 0.75; // 负载因子 (Load Factor)
+    void _bucket_erase(Bucket& bucket, typename Bucket::iterator it) {
+        if constexpr (_intrusive) {
+            Node* node = &*it;
+            bucket.erase(it);
+            delete node;
+        }
+        else {
+            bucket.erase(it);
+        }
+    }
+
+    // 释放所有节点，桶数组保持不变
+    void _clear_buckets();
+    // 把 other 中的所有元素插入本表 (拷贝构造 / 拷贝赋值使用)
+    void _copy_from(const MyHashMap& other);
+
     void _rehash();
+    void _rehash_to(size_t new_bucket_count); // 一次性把所有节点重新挂到 new_bucket_count 个桶上
 
 public:
     // 构造函数：初始化桶数组
-    explicit MyHashMap(size_t bucket_count = 16)
-        : _size(0)
+    // bucket_count 会被向上取整到 2 的幂
+    explicit MyHashMap(size_t bucket_count = 16, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+        : _size(0), _hasher(hash), _key_equal(equal), _migrate_pos(0), _incremental(false), _rehash_step(4),
+          _max_load_factor(0.75)
     {
-        _buckets.resize(bucket_count);
+        _buckets.resize(_round_up_pow2(bucket_count));
     }
 
+    MyHashMap(const MyHashMap& other)
+        : _size(0), _hasher(other._hasher), _key_equal(other._key_equal),
+          _migrate_pos(0), _incremental(other._incremental), _rehash_step(other._rehash_step),
+          _max_load_factor(other._max_load_factor)
+    {
+        _buckets.resize(other._buckets.size() == 0 ? 1 : other._buckets.size());
+        _copy_from(other);
+    }
+
+    MyHashMap& operator=(const MyHashMap& other) {
+        if (this != &other) {
+            _clear_buckets();
+            _old_buckets = MyVector<Bucket>();
+            _migrate_pos = 0;
+            _hasher = other._hasher;
+            _key_equal = other._key_equal;
+            _incremental = other._incremental;
+            _rehash_step = other._rehash_step;
+            _max_load_factor = other._max_load_factor;
+            _copy_from(other);
+        }
+        return *this;
+    }
+
+    // 移动：直接接管两个桶数组；other 留下一个只有 1 个桶的空表，仍然可以继续使用
+    MyHashMap(MyHashMap&& other)
+        : _buckets(std::move(other._buckets)), _size(other._size),
+          _hasher(other._hasher), _key_equal(other._key_equal),
+          _old_buckets(std::move(other._old_buckets)), _migrate_pos(other._migrate_pos),
+          _incremental(other._incremental), _rehash_step(other._rehash_step),
+          _max_load_factor(other._max_load_factor)
+    {
+        other._buckets.resize(1);
+        other._size = 0;
+        other._migrate_pos = 0;
+    }
+
+    MyHashMap& operator=(MyHashMap&& other) {
+        if (this != &other) {
+            _clear_buckets();
+            _buckets = std::move(other._buckets);
+            _old_buckets = std::move(other._old_buckets);
+            _size = other._size;
+            _migrate_pos = other._migrate_pos;
+            _hasher = other._hasher;
+            _key_equal = other._key_equal;
+            _incremental = other._incremental;
+            _rehash_step = other._rehash_step;
+            _max_load_factor = other._max_load_factor;
+            other._buckets.resize(1);
+            other._size = 0;
+            other._migrate_pos = 0;
+        }
+        return *this;
+    }
+
+    ~MyHashMap() { _clear_buckets(); }
+
+    // 开启/关闭渐进式 rehash。关闭时如果正在搬迁，会立刻把剩余的桶搬完。
+    void set_incremental_rehash(bool enabled, size_t buckets_per_step = 4) {
+        _incremental = enabled;
+        _rehash_step = buckets_per_step == 0 ? 1 : buckets_per_step;
+        if (!enabled) _finish_rehash();
+    }
+    bool incremental_rehash() const { return _incremental; }
+    bool is_rehashing() const { return _is_rehashing(); }
+
     void insert(const K& key, const V& value);
     V& operator[](const K& key);
 
     size_t size() const { return _size; }
 
+    // 预留空间：保证插入 n 个元素之前都不会再触发 rehash
+    void reserve(size_t n);
+
+    double load_factor() const { return static_cast<double>(_size) / _buckets.size(); }
+    double max_load_factor() const { return _max_load_factor; }
+    // 修改最大负载因子；如果当前负载已经超过新的上限，立刻扩容
+    void max_load_factor(double ml);
+
     //根据 key 查找，如果找到了，返回一个指向 value 的指针；如果没找到，返回 nullptr。
     V* find(const K& key);
     const V* find(const K& key) const;
 
+    // 异构查找：例如 MyHashMap<std::string, V> 可以直接用 std::string_view 查找
+    template <typename Q, typename H = Hash, typename E = KeyEqual, typename = _enable_if_transparent<H, E>>
+    V* find(const Q& key) {
+        Node* node = _find_node(key, _hash_of(key));
+        return node ? &node->value : nullptr;
+    }
+
+    template <typename Q, typename H = Hash, typename E = KeyEqual, typename = _enable_if_transparent<H, E>>
+    const V* find(const Q& key) const {
+        const Node* node = _find_node(key, _hash_of(key));
+        return node ? &node->value : nullptr;
+    }
+
     bool erase(const K &key);
 
+    // 批量插入 [first, last) 中的键值对 (元素需要有 first / second 成员，例如 std::pair<K, V>)。
+    // 对前向迭代器会先按元素个数 reserve，整个过程最多扩容一次。
+    template <typename InputIt>
+    void insert_bulk(InputIt first, InputIt last);
+
+    // 批量查找：out[i] 指向 keys[i] 对应的 value，找不到时为 nullptr，返回找到的个数。
+    // 先算出一批 key 的哈希值并预取它们的桶和链表头节点，再逐个比较，
+    // 这样各个 key 的缓存未命中可以同时进行，而不是一个接一个地等待。
+    // Keys / Out 可以是 MyVector 或 std::vector 这类支持 size() / operator[] 的容器，Out 还需要 resize()。
+    template <typename Keys, typename Out>
+    size_t find_batch(const Keys& keys, Out& out);
+
     size_t bucket_count() const {
         return _buckets.size();
     }
 };
 
-template <typename K, typename V>
-V* MyHashMap<K, V>::find(const K& key) {
-    size_t bucket_index = _get_bucket_index(key);
-    MyLinkedList<Node>& bucket = _buckets[bucket_index];
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+template <typename Q>
+typename MyHashMap<K, V, Hash, KeyEqual, Buckets>::Node* MyHashMap<K, V, Hash, KeyEqual, Buckets>::_find_node(const Q& key, size_t hash) const {
+    // MyLinkedList 的 const_iterator 只能拿到 const 数据，这里统一用非 const 的桶来查找，
+    // 由调用方 (const find) 负责加上 const
+    auto& buckets = const_cast<MyVector<Bucket>&>(_buckets);
+    Bucket& bucket = buckets[_bucket_index(hash, _buckets.size())];
 
     // 遍历桶
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (it.getNode()->data.key == key) {
-            // 找到了！返回这个节点 value 的地址
-            return  &it.getNode()->data.value;
-        }
+    auto it = _find_in_bucket(bucket, key, hash);
+    if (it != bucket.end()) {
+        return &*it;
     }
-    // 循环结束了还没找到，返回空指针
-    return nullptr;
-}
-
-template <typename K, typename V>
-const V* MyHashMap<K, V>::find(const K& key) const {
-    size_t bucket_index = _get_bucket_index(key);
-    const MyLinkedList<Node>& bucket = _buckets[bucket_index];
 
-    // 遍历桶
-    for (auto it = bucket.cbegin(); it != bucket.cend(); ++it) {
-        if (it.getNode()->data.key == key) {
-            // 找到了！返回这个节点 value 的地址
-            return  &it.getNode()->data.value;
+    // 正在渐进式 rehash：key 也可能还留在一个尚未搬迁的旧桶中
+    if (_is_rehashing()) {
+        size_t old_index = _bucket_index(hash, _old_buckets.size());
+        if (old_index >= _migrate_pos) {
+            auto& old_buckets = const_cast<MyVector<Bucket>&>(_old_buckets);
+            Bucket& old_bucket = old_buckets[old_index];
+            auto old_it = _find_in_bucket(old_bucket, key, hash);
+            if (old_it != old_bucket.end()) {
+                return &*old_it;
+            }
         }
     }
-    // 循环结束了还没找到，返回空指针
+    // 两个桶数组都没找到，返回空指针
     return nullptr;
 }
 
-template <typename K, typename V>
-void MyHashMap<K, V>::insert(const K& key, const V& value) {
-    // 1. 获取桶的索引和桶本身
-    size_t bucket_index = _get_bucket_index(key);
-    MyLinkedList<Node>& bucket = _buckets[bucket_index];
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+V* MyHashMap<K, V, Hash, KeyEqual, Buckets>::find(const K& key) {
+    Node* node = _find_node(key, _hash_of(key));
+    // 找到了！返回这个节点 value 的地址
+    return node ? &node->value : nullptr;
+}
 
-    // 2. 遍历桶，寻找key
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (it.getNode()->data.key == key) {
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+const V* MyHashMap<K, V, Hash, KeyEqual, Buckets>::find(const K& key) const {
+    const Node* node = _find_node(key, _hash_of(key));
+    return node ? &node->value : nullptr;
+}
 
-            // 3. 如果找到了，说明 key 已存在
-            //    更新这个节点的 value，然后就可以结束函数了
-            it.getNode()->data.value = value;
-            return;
-        }
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::insert(const K& key, const V& value) {
+    // 0. 渐进式 rehash：每次修改操作顺手搬迁几个旧桶
+    if (_is_rehashing()) _rehash_step_once();
+
+    // 1. 先查找 key (新表和尚未搬迁的旧桶都要看)
+    size_t hash = _hash_of(key);
+    Node* existing = _find_node(key, hash);
+    if (existing != nullptr) {
+        // 2. 如果找到了，说明 key 已存在
+        //    更新这个节点的 value，然后就可以结束函数了
+        existing->value = value;
+        return;
     }
 
-    // 4. 如果 for 循环正常结束了，说明 key 不存在
-    //    在桶的末尾添加一个新的 Node
-    bucket.push_back(Node(key,value));
+    // 3. 如果没找到，说明 key 不存在
+    //    在 (新) 桶的末尾添加一个新的 Node
+    Bucket& bucket = _buckets[_bucket_index(hash, _buckets.size())];
+    _bucket_push(bucket, key, value, hash);
 
-    // 5. 只有在真正添加了新节点时，才需要增加 _size
+    // 4. 只有在真正添加了新节点时，才需要增加 _size
     _size++;
 
     // 检查是否需要动态扩容
-    if (static_cast<double>(_size) / _buckets.size() > MAX_LOAD_FACTOR) {
+    if (_over_load(_size, _buckets.size())) {
         _rehash();
     }
 }
 
-template <typename K, typename V>
-V& MyHashMap<K, V>::operator[](const K& key) {
-    // 1. 获取桶的索引和桶本身
-    size_t bucket_index = _get_bucket_index(key);
-    MyLinkedList<Node>& bucket = _buckets[bucket_index];
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+V& MyHashMap<K, V, Hash, KeyEqual, Buckets>::operator[](const K& key) {
+    if (_is_rehashing()) _rehash_step_once();
 
-    // 2. 遍历桶，寻找 key
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (it.getNode()->data.key == key) {
-            return it.getNode()->data.value;
-        }
+    // 1. 寻找 key，找到了就直接返回
+    size_t hash = _hash_of(key);
+    Node* existing = _find_node(key, hash);
+    if (existing != nullptr) {
+        return existing->value;
     }
 
-    // 4. 如果循环结束了还没找到：
+    // 2. 如果没找到：
     //    A. 在桶的末尾插入一个新节点，其 value 为 V 类型的默认值 (V())。
-    bucket.push_back(Node(key,V()));
+    Bucket& bucket = _buckets[_bucket_index(hash, _buckets.size())];
+    Node& node = _bucket_push(bucket, key, V(), hash);
 
     //    B. 增加 _size
     _size++;
 
     //    C. 返回这个刚刚被创建的新节点的 value 的引用。
-    // 检查是否需要动态扩容
-    if (static_cast<double>(_size) / _buckets.size() > MAX_LOAD_FACTOR) {
+    // rehash 只是把链表节点重新挂到新桶上，节点本身不移动，所以这个引用在扩容后依然有效
+    if (_over_load(_size, _buckets.size())) {
         _rehash();
     }
-    return bucket.back().value;
+    return node.value;
 }
 
-template <typename K, typename V>
-bool MyHashMap<K, V>::erase(const K& key) {
-    size_t bucket_index = _get_bucket_index(key);
-    MyLinkedList<Node>& bucket = _buckets[bucket_index];
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+bool MyHashMap<K, V, Hash, KeyEqual, Buckets>::erase(const K& key) {
+    if (_is_rehashing()) _rehash_step_once();
+
+    size_t hash = _hash_of(key);
+    Bucket& bucket = _buckets[_bucket_index(hash, _buckets.size())];
+    auto it = _find_in_bucket(bucket, key, hash);
+    if (it != bucket.end()) {
+        _bucket_erase(bucket, it);
+        _size--;
+        return true;
+    }
 
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (it.getNode()->data.key == key) {
-            bucket.erase(it);
-            _size--;
-            return true;
+    // 也可能在尚未搬迁的旧桶中
+    if (_is_rehashing()) {
+        size_t old_index = _bucket_index(hash, _old_buckets.size());
+        if (old_index >= _migrate_pos) {
+            Bucket& old_bucket = _old_buckets[old_index];
+            auto old_it = _find_in_bucket(old_bucket, key, hash);
+            if (old_it != old_bucket.end()) {
+                _bucket_erase(old_bucket, old_it);
+                _size--;
+                return true;
+            }
         }
     }
     return false;
 }
 
-template <typename K, typename V>
-void MyHashMap<K, V>::_rehash() {
-    // 1. 计算新桶数并创建一个新的桶数组
-    size_t new_bucket_count = _buckets.size() * 2;
-    MyVector<MyLinkedList<Node>> new_buckets(new_bucket_count);
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+template <typename InputIt>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::insert_bulk(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+        // 输入中可能有重复的 key，这里按上限预留，多出来的桶只是让负载低一点
+        reserve(_size + static_cast<size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        insert(first->first, first->second);
+    }
+}
 
-    // 2. 遍历旧的桶数组 (_buckets)
-    for (size_t i = 0; i < _buckets.size(); i++) {
-        for (auto it= _buckets[i].begin(); it != _buckets[i].end(); ++it) {
-            // 3. 遍历当前桶（链表）中的每一个节点
-            const Node& current_bucket_data = it.getNode()->data;
-            const K& key = current_bucket_data.key;
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+template <typename Keys, typename Out>
+size_t MyHashMap<K, V, Hash, KeyEqual, Buckets>::find_batch(const Keys& keys, Out& out) {
+    static constexpr size_t BATCH = 16; // 每一批同时在途的预取数量，太大反而会把预取的缓存行挤出去
+    const size_t count = keys.size();
+    out.resize(count);
+
+    size_t found = 0;
+    size_t hashes[BATCH];
+    for (size_t base = 0; base < count; base += BATCH) {
+        size_t n = count - base < BATCH ? count - base : BATCH;
+
+        // 1. 算出这一批的哈希值，预取每个 key 所在的桶 (MyLinkedList 对象本身)
+        for (size_t i = 0; i < n; ++i) {
+            hashes[i] = _hash_of(keys[base + i]);
+            my_prefetch(&_buckets[_bucket_index(hashes[i], _buckets.size())]);
+        }
+        // 2. 桶已经在路上了，再预取每个桶的第一个链表节点
+        for (size_t i = 0; i < n; ++i) {
+            Bucket& bucket = _buckets[_bucket_index(hashes[i], _buckets.size())];
+            my_prefetch(bucket.begin().getNode());
+        }
+        // 3. 真正的比较 (渐进式 rehash 期间 _find_node 还会检查旧桶)
+        for (size_t i = 0; i < n; ++i) {
+            Node* node = _find_node(keys[base + i], hashes[i]);
+            out[base + i] = node ? &node->value : nullptr;
+            if (node) ++found;
+        }
+    }
+    return found;
+}
 
-            // 4. 用 *新的* 桶数量，重新计算哈希索引
-            std::hash<K> hasher;
-            size_t new_index = hasher(key) % new_bucket_count;
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_clear_buckets() {
+    if constexpr (_intrusive) {
+        // 侵入式链表不拥有节点，要自己 delete
+        auto dispose = [](Node& node) { delete &node; };
+        for (size_t i = 0; i < _buckets.size(); ++i) _buckets[i].clear_and_dispose(dispose);
+        for (size_t i = 0; i < _old_buckets.size(); ++i) _old_buckets[i].clear_and_dispose(dispose);
+    }
+    else {
+        for (size_t i = 0; i < _buckets.size(); ++i) {
+            while (!_buckets[i].empty()) _buckets[i].pop_front();
+        }
+        for (size_t i = 0; i < _old_buckets.size(); ++i) {
+            while (!_old_buckets[i].empty()) _old_buckets[i].pop_front();
+        }
+    }
+    _size = 0;
+}
 
-            // 5. 将当前节点的数据添加到新的桶中
-            new_buckets[new_index].push_back(current_bucket_data);
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_copy_from(const MyHashMap& other) {
+    // 节点里缓存了哈希值，直接按它挂到对应的桶上，不需要重新计算；
+    // other 中的 key 各不相同，也不需要先查找
+    reserve(other._size);
+    auto copy_all = [this](const MyVector<Bucket>& from) {
+        auto& buckets = const_cast<MyVector<Bucket>&>(from);
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            for (auto it = buckets[i].begin(); it != buckets[i].end(); ++it) {
+                const Node& node = *it;
+                _bucket_push(_buckets[_bucket_index(node.hash, _buckets.size())], node.key, node.value, node.hash);
+                _size++;
+            }
+        }
+    };
+    copy_all(other._buckets);
+    copy_all(other._old_buckets);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::reserve(size_t n) {
+    // 先把进行中的渐进式搬迁做完，保证只有一个桶数组
+    _finish_rehash();
+
+    // 找到能容纳 n 个元素而不超过负载上限的最小桶数 (2 的幂)
+    size_t count = _buckets.size();
+    while (_over_load(n, count)) count <<= 1;
+    if (count != _buckets.size()) {
+        _rehash_to(count);
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::max_load_factor(double ml) {
+    if (ml <= 0) return; // 非法值直接忽略
+    _max_load_factor = ml;
+
+    _finish_rehash();
+    size_t count = _buckets.size();
+    while (_over_load(_size, count)) count <<= 1;
+    if (count != _buckets.size()) {
+        _rehash_to(count);
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_rehash_step_once() {
+    size_t end = _migrate_pos + _rehash_step;
+    if (end > _old_buckets.size()) end = _old_buckets.size();
+
+    for (; _migrate_pos < end; ++_migrate_pos) {
+        Bucket& old_bucket = _old_buckets[_migrate_pos];
+        // 用缓存的哈希值直接算出新下标，把节点整个挂过去 (不拷贝、不重新分配)
+        while (!old_bucket.empty()) {
+            auto it = old_bucket.begin();
+            Bucket& target = _buckets[_bucket_index(it->hash, _buckets.size())];
+            target.splice(target.end(), old_bucket, it);
+        }
+    }
+
+    // 所有旧桶都搬完了：释放旧桶数组，rehash 结束
+    if (_migrate_pos == _old_buckets.size()) {
+        _old_buckets = MyVector<Bucket>();
+        _migrate_pos = 0;
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_finish_rehash() {
+    while (_is_rehashing()) {
+        _rehash_step_once();
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_rehash() {
+    if (_incremental) {
+        // 渐进式：上一轮还没搬完就先搬完 (正常负载下几乎不会发生)，
+        // 然后把当前桶数组整体“移交”给 _old_buckets (移动，不拷贝)，换上一个空的新桶数组
+        _finish_rehash();
+        size_t new_bucket_count = _buckets.size() * 2;
+        _old_buckets = std::move(_buckets);
+        _buckets = MyVector<Bucket>(new_bucket_count);
+        _migrate_pos = 0;
+        return;
+    }
+
+    _rehash_to(_buckets.size() * 2);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Buckets>
+void MyHashMap<K, V, Hash, KeyEqual, Buckets>::_rehash_to(size_t new_bucket_count) {
+    // 1. 创建一个新的桶数组
+    MyVector<Bucket> new_buckets(new_bucket_count);
+
+    // 2. 遍历旧的桶数组 (_buckets)
+    for (size_t i = 0; i < _buckets.size(); i++) {
+        Bucket& old_bucket = _buckets[i];
+        while (!old_bucket.empty()) {
+            // 3. 用节点里缓存的哈希值和 *新的* 桶数量计算下标，不再调用哈希函数
+            auto it = old_bucket.begin();
+            size_t new_index = _bucket_index(it->hash, new_bucket_count);
+
+            // 4. 把节点从旧链表摘下来挂到新桶末尾：只改指针，K 和 V 都不会被拷贝
+            new_buckets[new_index].splice(new_buckets[new_index].end(), old_bucket, it);
         }
     }
 
-    _buckets = new_buckets;
+    // 5. 旧桶此时全是空链表，直接用新桶数组替换 (移动，不拷贝)
+    _buckets = std::move(new_buckets);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,230 @@
+#ifndef MYINTRUSIVELIST_H
+#define MYINTRUSIVELIST_H
+
+#include <cstddef>
+#include <stdexcept> // std::out_of_range
+#include <utility>   // std::swap
+
+/*
+ * MyIntrusiveList: 侵入式双向链表
+ *
+ * MyLinkedList 自己申请节点，元素是节点里的一个成员 (Node { T data; prev; next; })。
+ * 侵入式链表反过来：prev / next 指针 (钩子, hook) 直接嵌在用户的类型里，链表只负责把对象串起来：
+ *   - 链表从不分配、释放、拷贝元素，对象的生命周期完全由调用方管理；
+ *   - 拿到对象本身就能 O(1) 地把它从链表中摘掉 (remove)，不需要先找到迭代器；
+ *   - 同一个对象可以继承多个带不同 Tag 的钩子，同时挂在多条链表上
+ *     (例如一个缓存条目既在哈希桶的链上，又在 LRU 淘汰链上)。
+ *
+ * 用法：
+ *   struct Entry : MyIntrusiveHook<> { int value; };
+ *   MyIntrusiveList<Entry> list;
+ *   Entry e; list.push_back(e);
+ *
+ *   struct LruTag {};
+ *   struct Item : MyIntrusiveHook<>, MyIntrusiveHook<LruTag> { ... };
+ *   MyIntrusiveList<Item> bucket;          // 使用默认钩子
+ *   MyIntrusiveList<Item, LruTag> lru;     // 使用 LruTag 钩子
+ *
+ * 注意：对象在链表中时不能被销毁或移动；链表析构时只是把剩下的元素摘下来。
+ * 与 MyLinkedList 一样，end() 是空指针，不能对 end() 做 --。
+ */
+template <typename Tag = void>
+struct MyIntrusiveHook {
+    MyIntrusiveHook* _hook_prev = nullptr;
+    MyIntrusiveHook* _hook_next = nullptr;
+
+    MyIntrusiveHook() = default;
+    // 拷贝对象时不拷贝链接关系：副本一开始不在任何链表里
+    MyIntrusiveHook(const MyIntrusiveHook&) : _hook_prev(nullptr), _hook_next(nullptr) {}
+    MyIntrusiveHook& operator=(const MyIntrusiveHook&) { return *this; }
+};
+
+template <typename T, typename Tag = void>
+class MyIntrusiveList {
+private:
+    using Hook = MyIntrusiveHook<Tag>;
+
+    Hook* _head;
+    Hook* _tail;
+    size_t _size;
+
+    static Hook* _hook_of(T& value) { return static_cast<Hook*>(&value); }
+    static T& _value_of(Hook* hook) { return static_cast<T&>(*hook); }
+
+    void _link_before(Hook* pos, Hook* hook); // pos 为 nullptr 时挂到末尾
+    void _unlink(Hook* hook);
+
+public:
+    class iterator {
+    public:
+        iterator(Hook* hook = nullptr) : _hook(hook) {}
+
+        T& operator*() const { return _value_of(_hook); }
+        T* operator->() const { return &_value_of(_hook); }
+
+        iterator& operator++() {
+            _hook = _hook->_hook_next;
+            return *this;
+        }
+        iterator& operator--() {
+            _hook = _hook->_hook_prev;
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return _hook == other._hook; }
+        bool operator!=(const iterator& other) const { return _hook != other._hook; }
+
+        Hook* getNode() const { return _hook; }
+
+    private:
+        Hook* _hook;
+    };
+
+    MyIntrusiveList() : _head(nullptr), _tail(nullptr), _size(0) {}
+
+    // 链表不拥有元素，拷贝没有意义；移动时直接接管整条链
+    MyIntrusiveList(const MyIntrusiveList&) = delete;
+    MyIntrusiveList& operator=(const MyIntrusiveList&) = delete;
+
+    MyIntrusiveList(MyIntrusiveList&& other) noexcept
+        : _head(other._head), _tail(other._tail), _size(other._size)
+    {
+        other._head = other._tail = nullptr;
+        other._size = 0;
+    }
+
+    MyIntrusiveList& operator=(MyIntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+            std::swap(_size, other._size);
+        }
+        return *this;
+    }
+
+    ~MyIntrusiveList() { clear(); }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    iterator begin() const { return iterator(_head); }
+    iterator end() const { return iterator(nullptr); }
+
+    // 由元素本身得到它的迭代器，O(1)。调用方保证 value 确实在这条链表里
+    static iterator iterator_to(T& value) { return iterator(_hook_of(value)); }
+
+    T& front() const {
+        if (empty()) {
+            throw std::out_of_range("Accessing front on empty list");
+        }
+        return _value_of(_head);
+    }
+
+    T& back() const {
+        if (empty()) {
+            throw std::out_of_range("Accessing back on empty list");
+        }
+        return _value_of(_tail);
+    }
+
+    void push_back(T& value) { _link_before(nullptr, _hook_of(value)); }
+    void push_front(T& value) { _link_before(_head, _hook_of(value)); }
+
+    // 在 pos 之前挂上 value，返回指向它的迭代器
+    iterator insert(iterator pos, T& value) {
+        _link_before(pos.getNode(), _hook_of(value));
+        return iterator(_hook_of(value));
+    }
+
+    void pop_front() {
+        if (empty()) {
+            throw std::out_of_range("Popping front on empty list");
+        }
+        _unlink(_head);
+    }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("Popping back on empty list");
+        }
+        _unlink(_tail);
+    }
+
+    // 摘下 pos 指向的元素 (不销毁它)，返回下一个元素的迭代器
+    iterator erase(iterator pos) {
+        Hook* hook = pos.getNode();
+        if (hook == nullptr) {
+            return end();
+        }
+        iterator next(hook->_hook_next);
+        _unlink(hook);
+        return next;
+    }
+
+    // 直接按对象摘下，O(1)
+    void remove(T& value) { _unlink(_hook_of(value)); }
+
+    // 把 other 中 it 指向的元素挪到本链表的 pos 之前
+    void splice(iterator pos, MyIntrusiveList& other, iterator it) {
+        Hook* hook = it.getNode();
+        if (hook == nullptr || hook == pos.getNode()) {
+            return;
+        }
+        other._unlink(hook);
+        _link_before(pos.getNode(), hook);
+    }
+
+    // 摘下所有元素 (不销毁)
+    void clear() {
+        clear_and_dispose([](T&) {});
+    }
+
+    // 摘下所有元素，并对每个元素调用 disposer(value)，通常用来 delete 由调用方 new 出来的对象
+    template <typename Disposer>
+    void clear_and_dispose(Disposer disposer) {
+        Hook* current = _head;
+        _head = _tail = nullptr;
+        _size = 0;
+        while (current != nullptr) {
+            Hook* next = current->_hook_next;
+            current->_hook_prev = current->_hook_next = nullptr;
+            disposer(_value_of(current));
+            current = next;
+        }
+    }
+};
+
+template <typename T, typename Tag>
+void MyIntrusiveList<T, Tag>::_link_before(Hook* pos, Hook* hook) {
+    if (pos == nullptr) {
+        hook->_hook_prev = _tail;
+        hook->_hook_next = nullptr;
+        if (_tail) _tail->_hook_next = hook;
+        else _head = hook;
+        _tail = hook;
+    }
+    else {
+        hook->_hook_next = pos;
+        hook->_hook_prev = pos->_hook_prev;
+        if (pos->_hook_prev) pos->_hook_prev->_hook_next = hook;
+        else _head = hook;
+        pos->_hook_prev = hook;
+    }
+    _size++;
+}
+
+template <typename T, typename Tag>
+void MyIntrusiveList<T, Tag>::_unlink(Hook* hook) {
+    if (hook->_hook_prev) hook->_hook_prev->_hook_next = hook->_hook_next;
+    else _head = hook->_hook_next;
+
+    if (hook->_hook_next) hook->_hook_next->_hook_prev = hook->_hook_prev;
+    else _tail = hook->_hook_prev;
+
+    hook->_hook_prev = nullptr;
+    hook->_hook_next = nullptr;
+    _size--;
+}
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef MYLRUCACHE_H
+#define MYLRUCACHE_H
+
+#include "MyHashMap.h"       // key -> 条目
+#include "MyIntrusiveList.h" // 条目之间的淘汰顺序
+#include <cstddef>
+#include <functional>        // std::function, std::equal_to
+#include <utility>           // std::move
+
+/*
+ * MyLRUCache: 有容量上限的缓存
+ *
+ * 常见的手写做法是 MyHashMap<K, MyLinkedList<...>::iterator> 再加一条 MyLinkedList，
+ * 每个条目要分配两次 (哈希表节点 + 链表节点)。这里把条目 (Entry) 直接放在 MyHashMap 的节点里，
+ * Entry 自带一个侵入式钩子，挂在淘汰链 (MyIntrusiveList) 上：
+ *   - 每个条目只有一次分配 (MyHashMap 的节点)；MyHashMap 扩容只重新挂节点，条目地址不变，钩子始终有效；
+ *   - get 只做一次哈希查找，命中后把条目挪到链头是 O(1) 的指针操作；
+ *   - 淘汰时从链尾取出条目，再按 key 从哈希表中删除，也是 O(1)。
+ *
+ * 淘汰策略 (MyCachePolicy)：
+ *   LRU          : 经典的最近最少使用。
+ *   SegmentedLRU : 分段 LRU (SLRU)。新条目先进入“试用段” (probation)，再次命中才升入“保护段” (protected)，
+ *                  保护段占容量的 80%，溢出时把保护段最旧的条目降回试用段头部；淘汰总是先从试用段尾部开始。
+ *                  只被访问一次的 key (例如一次扫描) 不会把反复访问的热点挤出去。
+ *
+ * 容量可以按条目数 (默认每个条目权重为 1)，也可以通过 set_weigher 按字节等任意权重计算。
+ * K 和 V 都需要可以默认构造 (条目通过 MyHashMap::operator[] 原地创建)。
+ */
+enum class MyCachePolicy {
+    LRU,
+    SegmentedLRU
+};
+
+template <typename K, typename V, typename Hash = MyHash<K>, typename KeyEqual = std::equal_to<>>
+class MyLRUCache {
+public:
+    using Weigher = std::function<size_t(const K&, const V&)>;
+    using EvictionCallback = std::function<void(const K&, const V&)>;
+
+private:
+    struct Entry : MyIntrusiveHook<> {
+        K key;              // 淘汰时需要按 key 从哈希表中删除
+        V value;
+        size_t weight = 0;
+        bool in_protected = false; // 仅 SegmentedLRU 使用
+    };
+
+    using List = MyIntrusiveList<Entry>;
+
+    MyHashMap<K, Entry, Hash, KeyEqual> _map;
+    List _probation;   // LRU 策略下只使用这一条链；链头最新，链尾最旧
+    List _protected;   // SegmentedLRU 的保护段
+    MyCachePolicy _policy;
+
+    size_t _capacity;          // 总权重上限
+    size_t _weight;            // 当前总权重
+    size_t _protected_weight;  // 保护段的总权重
+
+    Weigher _weigher;
+    EvictionCallback _on_evict;
+
+    size_t _hits;
+    size_t _misses;
+    size_t _evictions;
+
+    size_t _protected_capacity() const { return _capacity / 5 * 4; }
+
+    size_t _weigh(const K& key, const V& value) const {
+        return _weigher ? _weigher(key, value) : 1;
+    }
+
+    void _detach(Entry& entry);           // 从所在的链上摘下
+    void _touch(Entry& entry);            // 命中后按策略调整位置
+    void _evict_one();                    // 淘汰一个条目
+    void _shrink_to_capacity();
+
+public:
+    explicit MyLRUCache(size_t capacity, MyCachePolicy policy = MyCachePolicy::LRU)
+        : _policy(policy), _capacity(capacity), _weight(0), _protected_weight(0),
+          _hits(0), _misses(0), _evictions(0) {}
+
+    // 条目之间通过钩子互相链接，拷贝没有意义
+    MyLRUCache(const MyLRUCache&) = delete;
+    MyLRUCache& operator=(const MyLRUCache&) = delete;
+
+    ~MyLRUCache() {
+        // 先摘下所有钩子，再由 _map 释放条目
+        _probation.clear();
+        _protected.clear();
+    }
+
+    // 查找并把条目标记为“最近使用”；未命中返回 nullptr
+    V* get(const K& key);
+
+    // 只查看，不改变淘汰顺序，也不计入命中统计
+    const V* peek(const K& key) const {
+        const Entry* entry = _map.find(key);
+        return entry ? &entry->value : nullptr;
+    }
+
+    bool contains(const K& key) const { return _map.find(key) != nullptr; }
+
+    // 插入或更新，并标记为“最近使用”；超出容量时从最旧的条目开始淘汰。返回 true 表示新插入。
+    // 权重本身就超过总容量的条目放不进缓存：直接拒绝，不淘汰其他条目；
+    // 如果 key 已经在缓存里，旧的条目会被删除 (和 erase 一样，不触发淘汰回调)，免得之后读到过期的值
+    bool put(const K& key, const V& value);
+
+    // 主动删除 (不触发淘汰回调，不计入淘汰次数)
+    bool erase(const K& key);
+
+    void clear();
+
+    // 按权重计算容量，例如 [](const K& k, const V& v) { return k.size() + v.size(); }。
+    // 需要在插入元素之前设置
+    void set_weigher(Weigher weigher) { _weigher = std::move(weigher); }
+
+    // 每淘汰一个条目，在它被删除之前调用 callback(key, value)
+    void set_eviction_callback(EvictionCallback callback) { _on_evict = std::move(callback); }
+
+    // 调整容量，变小时立刻淘汰
+    void set_capacity(size_t capacity) {
+        _capacity = capacity;
+        _shrink_to_capacity();
+    }
+
+    size_t size() const { return _map.size(); }
+    bool empty() const { return _map.size() == 0; }
+    size_t capacity() const { return _capacity; }
+    size_t weight() const { return _weight; }
+    MyCachePolicy policy() const { return _policy; }
+
+    // --- 统计 ---
+    size_t hits() const { return _hits; }
+    size_t misses() const { return _misses; }
+    size_t evictions() const { return _evictions; }
+    double hit_rate() const {
+        size_t total = _hits + _misses;
+        return total == 0 ? 0.0 : static_cast<double>(_hits) / total;
+    }
+    void reset_stats() { _hits = _misses = _evictions = 0; }
+};
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void MyLRUCache<K, V, Hash, KeyEqual>::_detach(Entry& entry) {
+    if (entry.in_protected) {
+        _protected.remove(entry);
+        _protected_weight -= entry.weight;
+        entry.in_protected = false;
+    }
+    else {
+        _probation.remove(entry);
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void MyLRUCache<K, V, Hash, KeyEqual>::_touch(Entry& entry) {
+    if (_policy == MyCachePolicy::LRU) {
+        _probation.remove(entry);
+        _probation.push_front(entry);
+        return;
+    }
+
+    // SegmentedLRU：命中的条目进入 (或留在) 保护段头部
+    _detach(entry);
+    _protected.push_front(entry);
+    entry.in_protected = true;
+    _protected_weight += entry.weight;
+
+    // 保护段超出自己的份额：把最旧的条目降回试用段头部，给它最后一次机会
+    while (_protected_weight > _protected_capacity() && _protected.size() > 1) {
+        Entry& demoted = _protected.back();
+        _protected.pop_back();
+        _protected_weight -= demoted.weight;
+        demoted.in_protected = false;
+        _probation.push_front(demoted);
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void MyLRUCache<K, V, Hash, KeyEqual>::_evict_one() {
+    // 先淘汰试用段，试用段空了才动保护段
+    Entry& victim = _probation.empty() ? _protected.back() : _probation.back();
+    _detach(victim);
+    _weight -= victim.weight;
+    _evictions++;
+    if (_on_evict) {
+        _on_evict(victim.key, victim.value);
+    }
+    // victim 就在哈希表的节点里，先拷贝出 key 再删除
+    K key = victim.key;
+    _map.erase(key);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void MyLRUCache<K, V, Hash, KeyEqual>::_shrink_to_capacity() {
+    while (_weight > _capacity && _map.size() != 0) {
+        _evict_one();
+    }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+V* MyLRUCache<K, V, Hash, KeyEqual>::get(const K& key) {
+    Entry* entry = _map.find(key);
+    if (entry == nullptr) {
+        _misses++;
+        return nullptr;
+    }
+    _hits++;
+    _touch(*entry);
+    return &entry->value;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool MyLRUCache<K, V, Hash, KeyEqual>::put(const K& key, const V& value) {
+    size_t new_weight = _weigh(key, value);
+    if (new_weight > _capacity) {
+        // 先挂上链头再淘汰的话，会从链尾把其他条目全部淘汰掉，最后才轮到它自己
+        erase(key);
+        return false;
+    }
+
+    size_t before = _map.size();
+    Entry& entry = _map[key]; // 一次查找：存在就返回它，不存在就原地创建
+    bool inserted = _map.size() != before;
+
+    if (inserted) {
+        entry.key = key;
+        entry.value = value;
+        entry.weight = new_weight;
+        _weight += new_weight;
+        _probation.push_front(entry); // 两种策略下新条目都从试用段头部开始
+    }
+    else {
+        entry.value = value;
+        _weight = _weight - entry.weight + new_weight;
+        if (entry.in_protected) _protected_weight = _protected_weight - entry.weight + new_weight;
+        entry.weight = new_weight;
+        _touch(entry);
+    }
+
+    _shrink_to_capacity();
+    return inserted;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool MyLRUCache<K, V, Hash, KeyEqual>::erase(const K& key) {
+    Entry* entry = _map.find(key);
+    if (entry == nullptr) {
+        return false;
+    }
+    _detach(*entry);
+    _weight -= entry->weight;
+    return _map.erase(key);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void MyLRUCache<K, V, Hash, KeyEqual>::clear() {
+    _probation.clear();
+    _protected.clear();
+    _map = MyHashMap<K, Entry, Hash, KeyEqual>();
+    _weight = 0;
+    _protected_weight = 0;
+}
+
+#endif
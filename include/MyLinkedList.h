@@ -2,11 +2,13 @@
 #define MYLINKEDLIST_H
 
 #include <cstddef>
+#include <functional> // std::less, std::equal_to
 #include <iostream>
+#include <memory>    // std::allocator, std::allocator_traits
 #include <stdexcept> // for std::out_of_range
 #include <bits/regex_constants.h>
 
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class MyLinkedList {
 private:
     // 定义节点
@@ -20,9 +22,23 @@ private:
     };
 
 
+    // 节点通过 Alloc 重新绑定 (rebind) 出来的节点分配器申请。
+    // 默认的 std::allocator 等价于 new / delete；
+    // 换成 MyPoolAllocator (见 MyNodePool.h) 后，频繁的 push / pop 不会再走到 malloc。
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+
     Node* _head;
     Node* _tail;
     size_t _size;
+    NodeAlloc _alloc;
+
+    Node* _create_node(const T& value);  // 申请内存并构造节点
+    void _destroy_node(Node* node);      // 析构节点并归还内存
+
+    // 纯指针操作的辅助函数：只修改链接关系和 _size，不分配也不释放节点
+    void _unlink(Node* node);                 // 把 node 从本链表中摘下来
+    void _link_before(Node* pos, Node* node); // 把 node 挂到 pos 之前 (pos 为 nullptr 时挂到末尾)
 
 public:
     // 双向迭代器
@@ -144,61 +160,98 @@ public:
 
     iterator erase(iterator pos); //  按照 STL 惯例，它应该返回被删除元素的下一个元素的迭代器
 
+    // 把 other 中 it 指向的节点“剪切”到本链表的 pos 之前。
+    // 只修改指针，不拷贝元素、不分配内存，指向该元素的引用和指针依然有效。
+    // 节点之后由本链表的分配器释放，所以两个链表的分配器必须相等 (无状态分配器总是满足)。
+    void splice(iterator pos, MyLinkedList& other, iterator it);
+    // 把整个 other 挂到 pos 之前，O(1)；other 变为空链表
+    void splice(iterator pos, MyLinkedList& other);
+    // 把 other 中 [first, last) 这一段挂到 pos 之前。
+    // 需要数一遍这段的长度来维护两边的 _size (同一个链表内部移动时不需要)。
+    void splice(iterator pos, MyLinkedList& other, iterator first, iterator last);
+
+    // 在 pos 之前插入 value，返回指向新元素的迭代器
+    iterator insert(iterator pos, const T& value);
+
+    // 把已排好序的 other 归并进本链表 (本链表也必须已排好序)，稳定，只重新链接节点
+    void merge(MyLinkedList& other);
+    template <typename Compare>
+    void merge(MyLinkedList& other, Compare comp);
+
+    // 自底向上的归并排序：稳定，O(n log n)，不分配内存、不拷贝元素，所有迭代器依然有效
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+
+    // 删除相邻的重复元素，只保留每一段的第一个，返回删除的个数
+    size_t unique();
+    template <typename BinaryPredicate>
+    size_t unique(BinaryPredicate pred);
+
+    // 原地反转：交换每个节点的 prev / next
+    void reverse();
+
+private:
+    // 把以 a、b 开头的两条已排序的单链 (只看 next) 归并成一条，返回新的链头。相等时 a 中的元素在前。
+    template <typename Compare>
+    static Node* _merge_chains(Node* a, Node* b, Compare& comp);
+    // 按 next 重新设置整条链的 prev 指针以及 _head / _tail
+    void _relink_from(Node* head);
 };
 
 
 // 节点构造函数
-template <typename T>
-MyLinkedList<T>::Node::Node(const T& value)
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::Node::Node(const T& value)
     : data(value), next(nullptr), prev(nullptr) {}
 
 // ------------------- 迭代器实现 -------------------
 
 // 构造函数
-template <typename T>
-MyLinkedList<T>::iterator::iterator(Node* ptr) : _node_ptr(ptr) {}
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::iterator::iterator(Node* ptr) : _node_ptr(ptr) {}
 
 // 解引用 (*it)，返回节点数据的引用
-template <typename T>
-T& MyLinkedList<T>::iterator::operator*() {
+template <typename T, typename Alloc>
+T& MyLinkedList<T, Alloc>::iterator::operator*() {
     return _node_ptr->data;
 }
 
 // 成员访问 (it->member)，返回节点指针，以便访问 T 的成员
-template <typename T>
-T* MyLinkedList<T>::iterator::operator->() {
+template <typename T, typename Alloc>
+T* MyLinkedList<T, Alloc>::iterator::operator->() {
     return &(_node_ptr->data);
 }
 
 // 前缀递增 (++it)
-template <typename T>
-typename MyLinkedList<T>::iterator& MyLinkedList<T>::iterator::operator++() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator& MyLinkedList<T, Alloc>::iterator::operator++() {
     // 思考: 如何移动到下一个节点？
     _node_ptr = _node_ptr->next;
     return *this;
 }
 
 // 前缀递减 (--it)
-template <typename T>
-typename MyLinkedList<T>::iterator& MyLinkedList<T>::iterator::operator--() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator& MyLinkedList<T, Alloc>::iterator::operator--() {
     // 思考: 如何移动到上一个节点？
     _node_ptr = _node_ptr->prev;
     return *this;
 }
 
 // 比较操作 (it == other, it != other)
-template <typename T>
-bool MyLinkedList<T>::iterator::operator==(const iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::iterator::operator==(const iterator& other) const {
     return _node_ptr == other._node_ptr;
 }
 
-template <typename T>
-bool MyLinkedList<T>::iterator::operator!=(const iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::iterator::operator!=(const iterator& other) const {
     return _node_ptr != other._node_ptr;
 }
 
-template <typename T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(iterator pos) {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator MyLinkedList<T, Alloc>::erase(iterator pos) {
     // 0. 获取要删除的节点指针
     Node* node_to_delete = pos.getNode();
     if (node_to_delete == nullptr) {
@@ -228,136 +281,402 @@ typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(iterator pos) {
     }
 
     // 3. 释放内存并更新大小
-    delete node_to_delete;
+    _destroy_node(node_to_delete);
     _size--;
 
     // 4. 返回下一个节点的迭代器
     return next_it;
 }
 
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::Node* MyLinkedList<T, Alloc>::_create_node(const T& value) {
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    try {
+        NodeAllocTraits::construct(_alloc, node, value);
+    }
+    catch (...) {
+        // T 的拷贝构造抛异常时，先把内存还回去再继续抛出
+        NodeAllocTraits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::_destroy_node(Node* node) {
+    NodeAllocTraits::destroy(_alloc, node);
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::_unlink(Node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else _head = node->next;
+
+    if (node->next) node->next->prev = node->prev;
+    else _tail = node->prev;
+
+    node->prev = nullptr;
+    node->next = nullptr;
+    _size--;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::_link_before(Node* pos, Node* node) {
+    if (pos == nullptr) {
+        // 挂到末尾
+        node->prev = _tail;
+        node->next = nullptr;
+        if (_tail) _tail->next = node;
+        else _head = node;
+        _tail = node;
+    }
+    else {
+        node->next = pos;
+        node->prev = pos->prev;
+        if (pos->prev) pos->prev->next = node;
+        else _head = node;
+        pos->prev = node;
+    }
+    _size++;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::splice(iterator pos, MyLinkedList& other, iterator it) {
+    Node* node = it.getNode();
+    // 不能剪切 end()；把节点挪到它自己前面等于什么都不做
+    if (node == nullptr || node == pos.getNode()) {
+        return;
+    }
+    other._unlink(node);
+    _link_before(pos.getNode(), node);
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::splice(iterator pos, MyLinkedList& other) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+    Node* first = other._head;
+    Node* last = other._tail;
+    size_t count = other._size;
+    other._head = other._tail = nullptr;
+    other._size = 0;
+
+    // 把 [first, last] 整段挂到 pos 之前
+    Node* next = pos.getNode();
+    Node* prev = next ? next->prev : _tail;
+    first->prev = prev;
+    last->next = next;
+    if (prev) prev->next = first;
+    else _head = first;
+    if (next) next->prev = last;
+    else _tail = last;
+    _size += count;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::splice(iterator pos, MyLinkedList& other, iterator first, iterator last) {
+    if (first == last) {
+        return;
+    }
+    Node* first_node = first.getNode();
+    Node* last_node = last.getNode() ? last.getNode()->prev : other._tail; // 这一段的最后一个节点
+    // 同一个链表内部，pos 落在被移动的这一段上或紧挨着它时，什么都不用做
+    if (&other == this && (pos.getNode() == last.getNode() || pos.getNode() == first_node)) {
+        return;
+    }
+
+    size_t count = 0;
+    if (&other != this) {
+        for (Node* n = first_node; n != last.getNode(); n = n->next) count++;
+    }
+
+    // 1. 从 other 中摘下 [first_node, last_node]
+    if (first_node->prev) first_node->prev->next = last_node->next;
+    else other._head = last_node->next;
+    if (last_node->next) last_node->next->prev = first_node->prev;
+    else other._tail = first_node->prev;
+    other._size -= count;
+
+    // 2. 挂到 pos 之前
+    Node* next = pos.getNode();
+    Node* prev = next ? next->prev : _tail;
+    first_node->prev = prev;
+    last_node->next = next;
+    if (prev) prev->next = first_node;
+    else _head = first_node;
+    if (next) next->prev = last_node;
+    else _tail = last_node;
+    _size += count;
+}
+
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator MyLinkedList<T, Alloc>::insert(iterator pos, const T& value) {
+    Node* node = _create_node(value);
+    _link_before(pos.getNode(), node);
+    return iterator(node);
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+typename MyLinkedList<T, Alloc>::Node* MyLinkedList<T, Alloc>::_merge_chains(Node* a, Node* b, Compare& comp) {
+    // 不能用哑节点 (T 不一定能默认构造)，这里用“指向 next 指针的指针”来追加
+    Node* head = nullptr;
+    Node** tail_next = &head;
+    while (a != nullptr && b != nullptr) {
+        // 只有 b 严格小于 a 时才取 b，相等时先取 a，保证稳定
+        if (comp(b->data, a->data)) {
+            *tail_next = b;
+            b = b->next;
+        }
+        else {
+            *tail_next = a;
+            a = a->next;
+        }
+        tail_next = &(*tail_next)->next;
+    }
+    *tail_next = (a != nullptr) ? a : b;
+    return head;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::_relink_from(Node* head) {
+    _head = head;
+    Node* prev = nullptr;
+    for (Node* n = head; n != nullptr; n = n->next) {
+        n->prev = prev;
+        prev = n;
+    }
+    _tail = prev;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::merge(MyLinkedList& other) {
+    merge(other, std::less<>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void MyLinkedList<T, Alloc>::merge(MyLinkedList& other, Compare comp) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+    Node* head = _merge_chains(_head, other._head, comp);
+    _size += other._size;
+    other._head = other._tail = nullptr;
+    other._size = 0;
+    _relink_from(head);
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::sort() {
+    sort(std::less<>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void MyLinkedList<T, Alloc>::sort(Compare comp) {
+    if (_size < 2) {
+        return;
+    }
+    // bins[i] 要么为空，要么是一条长度为 2^i 的已排序链。
+    // 每次取下一个节点，像二进制加法进位一样和 bins[0], bins[1], ... 依次归并。
+    // bins 中下标越大的链越早进入，归并时放在前面 (作为 a)，从而保证稳定。
+    static constexpr size_t BINS = 64;
+    Node* bins[BINS] = {};
+    Node* current = _head;
+    while (current != nullptr) {
+        Node* carry = current;
+        current = current->next;
+        carry->next = nullptr;
+
+        size_t i = 0;
+        for (; i < BINS - 1 && bins[i] != nullptr; ++i) {
+            carry = _merge_chains(bins[i], carry, comp);
+            bins[i] = nullptr;
+        }
+        if (bins[i] != nullptr) {
+            carry = _merge_chains(bins[i], carry, comp);
+        }
+        bins[i] = carry;
+    }
+
+    // 从小到大收拢：较小下标的链是后来的元素
+    Node* result = nullptr;
+    for (size_t i = 0; i < BINS; ++i) {
+        if (bins[i] != nullptr) {
+            result = result ? _merge_chains(bins[i], result, comp) : bins[i];
+        }
+    }
+    _relink_from(result);
+}
+
+template <typename T, typename Alloc>
+size_t MyLinkedList<T, Alloc>::unique() {
+    return unique(std::equal_to<>());
+}
+
+template <typename T, typename Alloc>
+template <typename BinaryPredicate>
+size_t MyLinkedList<T, Alloc>::unique(BinaryPredicate pred) {
+    size_t removed = 0;
+    if (_head == nullptr) {
+        return removed;
+    }
+    Node* keep = _head;
+    while (keep->next != nullptr) {
+        Node* candidate = keep->next;
+        if (pred(keep->data, candidate->data)) {
+            _unlink(candidate);
+            _destroy_node(candidate);
+            removed++;
+        }
+        else {
+            keep = candidate;
+        }
+    }
+    return removed;
+}
+
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::reverse() {
+    Node* current = _head;
+    while (current != nullptr) {
+        Node* next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+    Node* old_head = _head;
+    _head = _tail;
+    _tail = old_head;
+}
+
 // ------------------- 常量迭代器实现(必须) -------------------
 
 // 构造函数
-template <typename T>
-MyLinkedList<T>::const_iterator::const_iterator(const Node* ptr) : _node_ptr(ptr) {}
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::const_iterator::const_iterator(const Node* ptr) : _node_ptr(ptr) {}
 
 // 从普通迭代器转换的构造函数
-template <typename T>
-MyLinkedList<T>::const_iterator::const_iterator(const iterator& it) : _node_ptr(it.getNode()) {}
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::const_iterator::const_iterator(const iterator& it) : _node_ptr(it.getNode()) {}
 
 // 解引用 (*it)
-template <typename T>
-const T& MyLinkedList<T>::const_iterator::operator*() const {
+template <typename T, typename Alloc>
+const T& MyLinkedList<T, Alloc>::const_iterator::operator*() const {
     return _node_ptr->data;
 }
 
 // 成员访问 (it->member)
-template <typename T>
-const T* MyLinkedList<T>::const_iterator::operator->() const {
+template <typename T, typename Alloc>
+const T* MyLinkedList<T, Alloc>::const_iterator::operator->() const {
     return &(_node_ptr->data);
 }
 
 // 前缀递增 (++it)
-template <typename T>
-typename MyLinkedList<T>::const_iterator& MyLinkedList<T>::const_iterator::operator++() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator& MyLinkedList<T, Alloc>::const_iterator::operator++() {
     _node_ptr = _node_ptr->next;
     return *this;
 }
 
 // 前缀递减 (--it)
-template <typename T>
-typename MyLinkedList<T>::const_iterator& MyLinkedList<T>::const_iterator::operator--() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator& MyLinkedList<T, Alloc>::const_iterator::operator--() {
     _node_ptr = _node_ptr->prev;
     return *this;
 }
 
 // 比较操作
-template <typename T>
-bool MyLinkedList<T>::const_iterator::operator==(const const_iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::const_iterator::operator==(const const_iterator& other) const {
     return _node_ptr == other._node_ptr;
 }
 
-template <typename T>
-bool MyLinkedList<T>::const_iterator::operator!=(const const_iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::const_iterator::operator!=(const const_iterator& other) const {
     return _node_ptr != other._node_ptr;
 }
 
 // ------------------- begin/end/cbegin/cend 实现 -------------------
 
-template <typename T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::begin() const {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator MyLinkedList<T, Alloc>::begin() const {
     return const_iterator(_head);
 }
 
-template <typename T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::end() const {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator MyLinkedList<T, Alloc>::end() const {
     return const_iterator(nullptr);
 }
 
-template <typename T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::cbegin() const {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator MyLinkedList<T, Alloc>::cbegin() const {
     return begin(); // 直接调用 const 版本的 begin()
 }
 
-template <typename T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::cend() const {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::const_iterator MyLinkedList<T, Alloc>::cend() const {
     return end(); // 直接调用 const 版本的 end()
 }
 
 // ------------------- 反向迭代器实现 -------------------
 
 // 构造函数，接收一个普通迭代器
-template <typename T>
-MyLinkedList<T>::reverse_iterator::reverse_iterator(iterator it) : current(it) {}
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::reverse_iterator::reverse_iterator(iterator it) : current(it) {}
 
 // 解引用操作
-template <typename T>
-T& MyLinkedList<T>::reverse_iterator::operator*() {
+template <typename T, typename Alloc>
+T& MyLinkedList<T, Alloc>::reverse_iterator::operator*() {
     // 直接解引用内部的正向迭代器
     return *current;
 }
 
 //  前缀递增操作
-template <typename T>
-typename MyLinkedList<T>::reverse_iterator& MyLinkedList<T>::reverse_iterator::operator++() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::reverse_iterator& MyLinkedList<T, Alloc>::reverse_iterator::operator++() {
     // 反向迭代器的++，就是让其内部的正向迭代器--
     --current;
     return *this;
 }
 
-template <typename T>
-typename MyLinkedList<T>::reverse_iterator& MyLinkedList<T>::reverse_iterator::operator--() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::reverse_iterator& MyLinkedList<T, Alloc>::reverse_iterator::operator--() {
     // 想要“反向”后退一步，就是让“正向”的迭代器++
     ++current;
     return *this;
 }
 
 // 比较操作: 直接比较内部的 current 迭代器
-template <typename T>
-bool MyLinkedList<T>::reverse_iterator::operator==(const reverse_iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::reverse_iterator::operator==(const reverse_iterator& other) const {
     return current == other.current;
 }
 
-template <typename T>
-bool MyLinkedList<T>::reverse_iterator::operator!=(const reverse_iterator& other) const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::reverse_iterator::operator!=(const reverse_iterator& other) const {
     return current != other.current;
 }
 
 // ------------------- MyLinkedList 成员函数实现 -------------------
 
 // 构造函数
-template <typename T>
-MyLinkedList<T>::MyLinkedList()
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::MyLinkedList()
     // 思考：一个空的链表，它的 head, tail, size 应该是什么？
-    : _head(nullptr), _tail(nullptr), _size(0)
+    : _head(nullptr), _tail(nullptr), _size(0), _alloc()
 {
     //std::cout << "LinkedList default constructor called!" << std::endl;
 }
 
 // 拷贝构造函数
-template <typename T>
-MyLinkedList<T>::MyLinkedList(const MyLinkedList& other)
-    : _head(nullptr), _tail(nullptr), _size(0)
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::MyLinkedList(const MyLinkedList& other)
+    : _head(nullptr), _tail(nullptr), _size(0),
+      _alloc(NodeAllocTraits::select_on_container_copy_construction(other._alloc))
 {
     //std::cout << "Copy constructor called!" << std::endl;
     // 遍历 'other' 链表中的每一个节点
@@ -369,8 +688,8 @@ MyLinkedList<T>::MyLinkedList(const MyLinkedList& other)
 }
 
 // 拷贝赋值运算符
-template <typename T>
-MyLinkedList<T>& MyLinkedList<T>::operator=(const MyLinkedList& other) {
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>& MyLinkedList<T, Alloc>::operator=(const MyLinkedList& other) {
     //std::cout << "Copy assignment operator called!" << std::endl;
 
     // 步骤 1: 检查自我赋值
@@ -395,8 +714,8 @@ MyLinkedList<T>& MyLinkedList<T>::operator=(const MyLinkedList& other) {
 }
 
 // 析构函数 (非常重要！)
-template <typename T>
-MyLinkedList<T>::~MyLinkedList() {
+template <typename T, typename Alloc>
+MyLinkedList<T, Alloc>::~MyLinkedList() {
     //std::cout << "LinkedList destructor called!" << std::endl;
 
     // 思考：如何安全地释放所有节点，防止内存泄漏？
@@ -404,26 +723,26 @@ MyLinkedList<T>::~MyLinkedList() {
     Node* current = _head;
     while (current != nullptr) {
         Node* next_node = current->next; // 先保存下一个节点的地址
-        delete current;                  // 再删除当前节点
+        _destroy_node(current);          // 再删除当前节点
         current = next_node;
     }
 }
 
 // 返回链表大小
-template <typename T>
-size_t MyLinkedList<T>::size() const {
+template <typename T, typename Alloc>
+size_t MyLinkedList<T, Alloc>::size() const {
     return _size;
 }
 
 // 判断链表是否为空
-template <typename T>
-bool MyLinkedList<T>::empty() const {
+template <typename T, typename Alloc>
+bool MyLinkedList<T, Alloc>::empty() const {
     return _size == 0;
 }
 
-template <typename T>
-void MyLinkedList<T>::push_back(const T& value) {
-    Node* new_node = new Node(value);
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::push_back(const T& value) {
+    Node* new_node = _create_node(value);
 
     if (empty()) {
         _head = new_node;
@@ -438,9 +757,9 @@ void MyLinkedList<T>::push_back(const T& value) {
     _size++;
 }
 
-template <typename T>
-void MyLinkedList<T>::push_front(const T& value) {
-    Node* new_node = new Node(value);
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::push_front(const T& value) {
+    Node* new_node = _create_node(value);
     if (empty()) {
         _head = new_node;
         _tail = new_node;
@@ -454,40 +773,40 @@ void MyLinkedList<T>::push_front(const T& value) {
     _size++;
 }
 
-template <typename T>
-T& MyLinkedList<T>::front() {
+template <typename T, typename Alloc>
+T& MyLinkedList<T, Alloc>::front() {
     if (empty()) {
         throw std::out_of_range("Accessing front on empty list");
     }
     return _head->data;
 }
 
-template <typename T>
-const T& MyLinkedList<T>::front() const {
+template <typename T, typename Alloc>
+const T& MyLinkedList<T, Alloc>::front() const {
     if (empty()) {
         throw std::out_of_range("Accessing front on empty list");
     }
     return _head->data;
 }
 
-template <typename T>
-T& MyLinkedList<T>::back() {
+template <typename T, typename Alloc>
+T& MyLinkedList<T, Alloc>::back() {
     if (empty()) {
         throw std::out_of_range("Accessing back on empty list");
     }
     return _tail->data;
 }
 
-template <typename T>
-const T& MyLinkedList<T>::back() const {
+template <typename T, typename Alloc>
+const T& MyLinkedList<T, Alloc>::back() const {
     if (empty()) {
         throw std::out_of_range("Accessing back on empty list");
     }
     return _tail->data;
 }
 
-template <typename T>
-void MyLinkedList<T>::pop_front() {
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::pop_front() {
     if (empty()) {
         throw std::out_of_range("Popping front on empty list");
     }
@@ -503,13 +822,13 @@ void MyLinkedList<T>::pop_front() {
         _head->prev = nullptr;
     }
 
-    delete node_to_delete;
+    _destroy_node(node_to_delete);
 
     _size--;
 }
 
-template <typename T>
-void MyLinkedList<T>::pop_back() {
+template <typename T, typename Alloc>
+void MyLinkedList<T, Alloc>::pop_back() {
     if (empty()) {
         throw std::out_of_range("Popping back on empty list");
     }
@@ -525,31 +844,31 @@ void MyLinkedList<T>::pop_back() {
         _tail->next = nullptr;
     }
 
-    delete node_to_delete;
+    _destroy_node(node_to_delete);
 
     _size--;
 }
 
-template <typename T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::begin() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator MyLinkedList<T, Alloc>::begin() {
     return iterator(_head);
 }
 
-template <typename T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::end() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::iterator MyLinkedList<T, Alloc>::end() {
     return iterator(nullptr);
 }
 
 // rbegin() 实现
-template <typename T>
-typename MyLinkedList<T>::reverse_iterator MyLinkedList<T>::rbegin() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::reverse_iterator MyLinkedList<T, Alloc>::rbegin() {
     // rbegin() 指向链表的最后一个元素
     return reverse_iterator(iterator(_tail));
 }
 
 //  rend() 实现
-template <typename T>
-typename MyLinkedList<T>::reverse_iterator MyLinkedList<T>::rend() {
+template <typename T, typename Alloc>
+typename MyLinkedList<T, Alloc>::reverse_iterator MyLinkedList<T, Alloc>::rend() {
     // rend() 指向链表第一个元素之前的位置 (nullptr)
     return reverse_iterator(iterator(nullptr));
 }
@@ -0,0 +1,295 @@
+#ifndef MYMPMCQUEUE_H
+#define MYMPMCQUEUE_H
+
+#include "MySPSCQueue.h" // MyWaitStrategy, my_wait_until, my_futex_wait / my_futex_wake
+#include <atomic>
+#include <climits>       // INT_MAX
+#include <cstddef>
+#include <cstdint>
+#include <new>           // placement new
+#include <type_traits>   // std::aligned_storage
+#include <utility>       // std::move, std::forward
+
+/*
+ * MyMPMCQueue: 多生产者 / 多消费者 (MPMC) 的无锁有界队列
+ *
+ * 采用“每个槽位一个序号”的环形数组设计 (Dmitry Vyukov 的 bounded MPMC queue)：
+ *   - 槽位 i 的 sequence 初始为 i；
+ *   - 生产者用 CAS 把 _enqueue_pos 从 pos 推进到 pos + 1 来认领槽位，条件是该槽位的 sequence == pos
+ *     (说明上一轮的元素已经被取走)；写入元素后把 sequence 置为 pos + 1，表示“可读”；
+ *   - 消费者同理：认领 _dequeue_pos，要求 sequence == pos + 1；取走元素后把 sequence 置为 pos + capacity，
+ *     表示“下一轮可写”。
+ * 生产者之间只在 _enqueue_pos 上竞争，消费者之间只在 _dequeue_pos 上竞争，两边互不干扰；
+ * 元素的发布 / 回收通过各自槽位上的 release / acquire 完成，不需要锁。
+ *
+ * 批量操作一次 CAS 认领一段连续的槽位 (只认领序号已经就绪的那一段前缀)，然后逐个写入 / 读取。
+ *
+ * push / pop 在队列满 / 空时按 MyWaitStrategy 等待 (与 MySPSCQueue 相同)；
+ * Block 模式下可能有多个线程睡在同一个 futex 上，状态改变时全部唤醒，由它们重新竞争。
+ */
+template <typename T>
+class MyMPMCQueue {
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T* value() { return reinterpret_cast<T*>(&storage); }
+    };
+
+    struct alignas(CACHE_LINE) Waiter {
+        std::atomic<uint32_t> epoch{0};
+        std::atomic<uint32_t> sleepers{0}; // 可能在 futex 上睡眠的线程数
+    };
+
+    alignas(CACHE_LINE) std::atomic<size_t> _enqueue_pos; // 生产者之间竞争
+    alignas(CACHE_LINE) std::atomic<size_t> _dequeue_pos; // 消费者之间竞争
+
+    alignas(CACHE_LINE) Cell* _cells;
+    size_t _capacity;
+    size_t _mask;
+    MyWaitStrategy _wait;
+
+    Waiter _not_empty;
+    Waiter _not_full;
+
+    static size_t _round_up_pow2(size_t n) {
+        size_t count = 2;
+        while (count < n) count <<= 1;
+        return count;
+    }
+
+    // 序号的差值：序号单调递增，绕回后用有符号差值比较仍然正确
+    static intptr_t _diff(size_t a, size_t b) {
+        return static_cast<intptr_t>(a) - static_cast<intptr_t>(b);
+    }
+
+    // 认领到槽位 pos 之后写入 / 取出元素，并通过 sequence 把槽位交给另一方
+    template <typename U>
+    void _publish(size_t pos, U&& value) {
+        Cell& cell = _cells[pos & _mask];
+        ::new (cell.value()) T(std::forward<U>(value));
+        cell.sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    void _consume(size_t pos, T& out) {
+        Cell& cell = _cells[pos & _mask];
+        out = std::move(*cell.value());
+        cell.value()->~T();
+        cell.sequence.store(pos + _capacity, std::memory_order_release);
+    }
+
+    // 认领一个可写的槽位，失败 (队列满) 返回 false
+    bool _claim_enqueue(size_t& pos) {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t seq = _cells[pos & _mask].sequence.load(std::memory_order_acquire);
+            intptr_t diff = _diff(seq, pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return true;
+            }
+            else if (diff < 0) {
+                return false; // 这个槽位上一轮的元素还没被取走
+            }
+            else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed); // 被别的生产者抢先了
+            }
+        }
+    }
+
+    bool _claim_dequeue(size_t& pos) {
+        pos = _dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t seq = _cells[pos & _mask].sequence.load(std::memory_order_acquire);
+            intptr_t diff = _diff(seq, pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return true;
+            }
+            else if (diff < 0) {
+                return false; // 这个槽位还没有被写入
+            }
+            else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 认领最多 n 个连续槽位：expected_offset 为 0 时认领可写槽位，为 1 时认领可读槽位
+    size_t _claim_range(std::atomic<size_t>& position, size_t expected_offset, size_t n, size_t& pos) {
+        pos = position.load(std::memory_order_relaxed);
+        if (n == 0) return 0;
+        for (;;) {
+            size_t count = 0;
+            while (count < n && count < _capacity) {
+                size_t seq = _cells[(pos + count) & _mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count + expected_offset) break;
+                count++;
+            }
+            if (count == 0) {
+                size_t seq = _cells[pos & _mask].sequence.load(std::memory_order_acquire);
+                if (_diff(seq, pos + expected_offset) < 0) return 0; // 满 / 空
+                pos = position.load(std::memory_order_relaxed);      // 别的线程抢先了，重新读位置
+                continue;
+            }
+            if (position.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) return count;
+        }
+    }
+
+    bool _has_space() const {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        return _diff(_cells[pos & _mask].sequence.load(std::memory_order_acquire), pos) >= 0;
+    }
+
+    bool _has_items() const {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        return _diff(_cells[pos & _mask].sequence.load(std::memory_order_acquire), pos + 1) >= 0;
+    }
+
+    void _notify(Waiter& waiter) {
+        if (_wait != MyWaitStrategy::Block) return;
+        // 与 _wait_until 中的 fence 配对：要么睡眠方看到了新状态，要么这里看到了 sleepers
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiter.sleepers.load(std::memory_order_relaxed) != 0) {
+            waiter.epoch.fetch_add(1, std::memory_order_release);
+            my_futex_wake(&waiter.epoch, INT_MAX);
+        }
+    }
+
+    template <typename Ready>
+    void _wait_until(Waiter& waiter, Ready ready) {
+        my_wait_until(_wait, ready, [&waiter, &ready] {
+            uint32_t epoch = waiter.epoch.load(std::memory_order_acquire);
+            waiter.sleepers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!ready()) {
+                my_futex_wait(&waiter.epoch, epoch);
+            }
+            waiter.sleepers.fetch_sub(1, std::memory_order_relaxed);
+        });
+    }
+
+public:
+    // capacity 会被向上取整到 2 的幂 (至少为 2)
+    explicit MyMPMCQueue(size_t capacity, MyWaitStrategy wait = MyWaitStrategy::Spin)
+        : _enqueue_pos(0), _dequeue_pos(0), _wait(wait)
+    {
+        _capacity = _round_up_pow2(capacity);
+        _mask = _capacity - 1;
+        _cells = static_cast<Cell*>(::operator new(_capacity * sizeof(Cell)));
+        for (size_t i = 0; i < _capacity; ++i) {
+            ::new (&_cells[i]) Cell;
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MyMPMCQueue() {
+        size_t end = _enqueue_pos.load(std::memory_order_relaxed);
+        for (size_t pos = _dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos) {
+            _cells[pos & _mask].value()->~T();
+        }
+        ::operator delete(_cells);
+    }
+
+    MyMPMCQueue(const MyMPMCQueue&) = delete;
+    MyMPMCQueue& operator=(const MyMPMCQueue&) = delete;
+
+    bool try_push(const T& value) {
+        size_t pos;
+        if (!_claim_enqueue(pos)) return false;
+        _publish(pos, value);
+        _notify(_not_empty);
+        return true;
+    }
+
+    // 失败时不会移动 value
+    bool try_push(T&& value) {
+        size_t pos;
+        if (!_claim_enqueue(pos)) return false;
+        _publish(pos, std::move(value));
+        _notify(_not_empty);
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        size_t pos;
+        if (!_claim_dequeue(pos)) return false;
+        _consume(pos, out);
+        _notify(_not_full);
+        return true;
+    }
+
+    // 批量入队：一次 CAS 认领尽可能多的连续槽位，返回实际写入的个数 (0 表示队列满)
+    size_t try_push_bulk(const T* items, size_t n) {
+        size_t pos;
+        size_t count = _claim_range(_enqueue_pos, 0, n, pos);
+        for (size_t i = 0; i < count; ++i) {
+            _publish(pos + i, items[i]);
+        }
+        if (count > 0) _notify(_not_empty);
+        return count;
+    }
+
+    // 批量出队：最多取 n 个，返回实际取出的个数 (0 表示队列空)
+    size_t try_pop_bulk(T* out, size_t n) {
+        size_t pos;
+        size_t count = _claim_range(_dequeue_pos, 1, n, pos);
+        for (size_t i = 0; i < count; ++i) {
+            _consume(pos + i, out[i]);
+        }
+        if (count > 0) _notify(_not_full);
+        return count;
+    }
+
+    void push(const T& value) {
+        while (!try_push(value)) {
+            _wait_until(_not_full, [this] { return _has_space(); });
+        }
+    }
+
+    void push(T&& value) {
+        while (!try_push(std::move(value))) {
+            _wait_until(_not_full, [this] { return _has_space(); });
+        }
+    }
+
+    void pop(T& out) {
+        while (!try_pop(out)) {
+            _wait_until(_not_empty, [this] { return _has_items(); });
+        }
+    }
+
+    // 阻塞地写入全部 n 个元素
+    void push_bulk(const T* items, size_t n) {
+        while (n > 0) {
+            size_t pushed = try_push_bulk(items, n);
+            if (pushed == 0) {
+                _wait_until(_not_full, [this] { return _has_space(); });
+            }
+            items += pushed;
+            n -= pushed;
+        }
+    }
+
+    // 阻塞直到至少取出一个元素，返回取出的个数 (1..n)
+    size_t pop_bulk(T* out, size_t n) {
+        for (;;) {
+            size_t popped = try_pop_bulk(out, n);
+            if (popped > 0) return popped;
+            _wait_until(_not_empty, [this] { return _has_items(); });
+        }
+    }
+
+    // 并发修改时只是一个近似值
+    size_t size_approx() const {
+        size_t tail = _enqueue_pos.load(std::memory_order_acquire);
+        size_t head = _dequeue_pos.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool empty_approx() const { return size_approx() == 0; }
+    size_t capacity() const { return _capacity; }
+};
+
+#endif
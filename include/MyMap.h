@@ -4,6 +4,8 @@
 #define MYSTL_MYMAP_H
 
 #include "MyBST.h"
+#include "MyAVLTree.h"
+#include <utility>
 
 // 1. 定义 Pair 结构体
 template <typename Key, typename Value>
@@ -36,11 +38,12 @@ struct Pair {
 };
 
 // 2. 搭建 MyMap 框架
-template <typename Key, typename Value>
+// Tree 是底层的树引擎，默认 MyBST；键按顺序到达时用 MyAVLTree 保持平衡：MyMapPro<Key, Value, MyAVLTree>
+template <typename Key, typename Value, template <typename> class Tree = MyBST>
 class MyMapPro {
 private:
-    // 使用 MyBST 存储 Pair 对象
-    MyBST<Pair<Key, Value>> _tree;
+    // 使用 Tree 存储 Pair 对象
+    Tree<Pair<Key, Value>> _tree;
 
 public:
     void insert(const Key& key, const Value& value);
@@ -51,10 +54,33 @@ public:
     size_t size() const { return _tree.size(); }
     bool empty() const { return _tree.empty(); }
     void clear() { _tree.clear(); }
+
+    // 用按 key 升序排好的 Pair<Key, Value> 区间 [first, last) 替换整个 map 的内容，O(n)。
+    // key 相同的相邻元素只保留第一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last) { _tree.build_from_sorted(first, last); }
+
+    // 顺序统计 (按 key 排序)：第 k 小的键值对 (k 从 0 开始，越界返回 nullptr)、
+    // 严格小于 key 的键个数、[lo, hi) 中的键个数
+    const Pair<Key, Value>* select(size_t k) const { return _tree.select(k); }
+    size_t rank(const Key& key) const { return _tree.rank(Pair<Key, Value>(key)); }
+    size_t count_in_range(const Key& lo, const Key& hi) const {
+        return _tree.count_in_range(Pair<Key, Value>(lo), Pair<Key, Value>(hi));
+    }
+
+    // 区间查询：key 落在 [lo, hi) 中的键值对，按 key 升序，O(log n + k)。
+    // range 返回一对迭代器 (元素是 const Pair&)；for_each_in_range 对每个键值对调用 visit，visit 返回 false 时提前结束
+    auto range(const Key& lo, const Key& hi) const {
+        return _tree.range(Pair<Key, Value>(lo), Pair<Key, Value>(hi));
+    }
+    template <typename Visitor>
+    void for_each_in_range(const Key& lo, const Key& hi, Visitor&& visit) const {
+        _tree.for_each_in_range(Pair<Key, Value>(lo), Pair<Key, Value>(hi), std::forward<Visitor>(visit));
+    }
 };
 
-template<typename Key, typename Value>
-void MyMapPro<Key, Value>::insert(const Key &key, const Value &value) {
+template<typename Key, typename Value, template <typename> class Tree>
+void MyMapPro<Key, Value, Tree>::insert(const Key &key, const Value &value) {
     // 为了查找，我们需要一个临时的 Pair 对象，
     // 它的 value 部分是什么无所谓，因为比较只看 key。
     Pair<Key, Value> temp_pair(key, Value{}); // Value{} 是 T 类型的默认构造
@@ -65,8 +91,8 @@ void MyMapPro<Key, Value>::insert(const Key &key, const Value &value) {
     }
 }
 
-template<typename Key, typename Value>
-Value *MyMapPro<Key, Value>::find(const Key &key) const{
+template<typename Key, typename Value, template <typename> class Tree>
+Value *MyMapPro<Key, Value, Tree>::find(const Key &key) const{
     Pair<Key, Value> temp_pair(key);
     Pair<Key, Value>* found_pair = _tree.find_value(temp_pair);// 传入整个 Pair
 
@@ -78,8 +104,8 @@ Value *MyMapPro<Key, Value>::find(const Key &key) const{
     return nullptr;
 }
 
-template<typename Key, typename Value>
-Value &MyMapPro<Key, Value>::operator[](const Key &key) {
+template<typename Key, typename Value, template <typename> class Tree>
+Value &MyMapPro<Key, Value, Tree>::operator[](const Key &key) {
     Value* found_value = find(key);
 
     if (found_value != nullptr) {
@@ -94,8 +120,8 @@ Value &MyMapPro<Key, Value>::operator[](const Key &key) {
     }
 }
 
-template<typename Key, typename Value>
-void MyMapPro<Key, Value>::erase(const Key &key) {
+template<typename Key, typename Value, template <typename> class Tree>
+void MyMapPro<Key, Value, Tree>::erase(const Key &key) {
     _tree.remove(key);
 }
 
@@ -6,6 +6,7 @@
 #define MYSTL_MYMAPPRO_H
 
 #include "MyTreap.h"
+#include <utility>
 
 // 1. 定义 Pair 结构体
 template <typename Key, typename Value>
@@ -53,6 +54,29 @@ public:
     size_t size() const { return _tree.size(); }
     bool empty() const { return _tree.empty(); }
     void clear() { _tree.clear(); }
+
+    // 用按 key 升序排好的 Pair<Key, Value> 区间 [first, last) 替换整个 map 的内容，O(n)。
+    // key 相同的相邻元素只保留第一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last) { _tree.build_from_sorted(first, last); }
+
+    // 顺序统计 (按 key 排序)：第 k 小的键值对 (k 从 0 开始，越界返回 nullptr)、
+    // 严格小于 key 的键个数、[lo, hi) 中的键个数
+    const Pair<Key, Value>* select(size_t k) const { return _tree.select(k); }
+    size_t rank(const Key& key) const { return _tree.rank(Pair<Key, Value>(key)); }
+    size_t count_in_range(const Key& lo, const Key& hi) const {
+        return _tree.count_in_range(Pair<Key, Value>(lo), Pair<Key, Value>(hi));
+    }
+
+    // 区间查询：key 落在 [lo, hi) 中的键值对，按 key 升序，O(log n + k)。
+    // range 返回一对迭代器 (元素是 const Pair&)；for_each_in_range 对每个键值对调用 visit，visit 返回 false 时提前结束
+    auto range(const Key& lo, const Key& hi) const {
+        return _tree.range(Pair<Key, Value>(lo), Pair<Key, Value>(hi));
+    }
+    template <typename Visitor>
+    void for_each_in_range(const Key& lo, const Key& hi, Visitor&& visit) const {
+        _tree.for_each_in_range(Pair<Key, Value>(lo), Pair<Key, Value>(hi), std::forward<Visitor>(visit));
+    }
 };
 
 template<typename Key, typename Value>
@@ -0,0 +1,269 @@
+#ifndef MYNODEPOOL_H
+#define MYNODEPOOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>          // ::operator new(size, align_val_t)
+
+/*
+ * 定长节点池 (node pool)
+ *
+ * 链表、链式哈希表这类容器每次插入都要 new 一个大小固定的节点，删除时再 delete，
+ * 高频进出的场景下 malloc / free 会占掉大部分时间。节点池的做法是：
+ *   1. 一次向系统申请一大块内存 (slab)，切成许多大小相同的块 (chunk)；
+ *   2. 空闲的块用一个单链表 (free list) 串起来，链表指针直接存放在空闲块自身的内存里；
+ *   3. 分配 = 从 free list 头部取一块，释放 = 把块放回 free list 头部，都是 O(1)，
+ *      free list 空了才再申请一个新的 slab。
+ * slab 只会在节点池析构时统一归还给系统。
+ *
+ * MyFixedPool       : 单线程的节点池本体，不加锁。
+ * MyPoolAllocator<T>: 满足标准 Allocator 要求的无状态分配器，可以作为 MyLinkedList 的 Alloc 参数。
+ *                     同一种块大小的所有容器共享一个全局节点池 (加锁)，
+ *                     PerThreadCache = true 时每个线程前面还有一个不加锁的本地缓存，
+ *                     大部分分配和释放都不需要碰那把锁。
+ */
+class MyFixedPool {
+private:
+    struct FreeChunk {
+        FreeChunk* next;
+    };
+
+    size_t _chunk_size;
+    size_t _chunk_align;
+    size_t _chunks_per_slab;
+    void* _slabs;           // 所有 slab 串成的单链表，每个 slab 的开头存放下一个 slab 的地址
+    FreeChunk* _free_list;
+    size_t _slab_count;
+    size_t _in_use;         // 已经分配出去、还没有归还的块数
+
+    static constexpr size_t SLAB_BYTES = 64 * 1024;
+
+    size_t _header_size() const {
+        // slab 开头留出一个对齐过的位置存放 next slab 指针
+        return (sizeof(void*) + _chunk_align - 1) / _chunk_align * _chunk_align;
+    }
+
+    void _grow() {
+        size_t bytes = _header_size() + _chunk_size * _chunks_per_slab;
+        void* slab = ::operator new(bytes, std::align_val_t(_chunk_align));
+        *static_cast<void**>(slab) = _slabs;
+        _slabs = slab;
+        _slab_count++;
+
+        // 倒序压入 free list，这样分配时是按地址从低到高依次取出的
+        char* first = static_cast<char*>(slab) + _header_size();
+        for (size_t i = _chunks_per_slab; i > 0; --i) {
+            FreeChunk* chunk = reinterpret_cast<FreeChunk*>(first + (i - 1) * _chunk_size);
+            chunk->next = _free_list;
+            _free_list = chunk;
+        }
+    }
+
+public:
+    MyFixedPool(size_t chunk_size, size_t chunk_align = alignof(std::max_align_t))
+        : _slabs(nullptr), _free_list(nullptr), _slab_count(0), _in_use(0)
+    {
+        _chunk_align = chunk_align < alignof(FreeChunk) ? alignof(FreeChunk) : chunk_align;
+        if (chunk_size < sizeof(FreeChunk)) chunk_size = sizeof(FreeChunk);
+        // 块大小向上取整到对齐的整数倍，保证每个块的起始地址都是对齐的
+        _chunk_size = (chunk_size + _chunk_align - 1) / _chunk_align * _chunk_align;
+        _chunks_per_slab = SLAB_BYTES / _chunk_size;
+        if (_chunks_per_slab < 8) _chunks_per_slab = 8;
+    }
+
+    ~MyFixedPool() {
+        while (_slabs != nullptr) {
+            void* next = *static_cast<void**>(_slabs);
+            ::operator delete(_slabs, std::align_val_t(_chunk_align));
+            _slabs = next;
+        }
+    }
+
+    MyFixedPool(const MyFixedPool&) = delete;
+    MyFixedPool& operator=(const MyFixedPool&) = delete;
+
+    void* allocate() {
+        if (_free_list == nullptr) _grow();
+        FreeChunk* chunk = _free_list;
+        _free_list = chunk->next;
+        _in_use++;
+        return chunk;
+    }
+
+    void deallocate(void* p) {
+        FreeChunk* chunk = static_cast<FreeChunk*>(p);
+        chunk->next = _free_list;
+        _free_list = chunk;
+        _in_use--;
+    }
+
+    size_t chunk_size() const { return _chunk_size; }
+    size_t slab_count() const { return _slab_count; }
+    size_t in_use() const { return _in_use; }
+};
+
+// 同一种 (块大小, 对齐) 的全局共享节点池，内部加锁。
+// 故意不析构：静态对象的析构顺序不确定，某个全局容器可能在它之后才释放节点。
+template <size_t ChunkSize, size_t ChunkAlign>
+class MySharedPool {
+private:
+    std::mutex _mutex;
+    MyFixedPool _pool;
+
+    MySharedPool() : _pool(ChunkSize, ChunkAlign) {}
+
+public:
+    static MySharedPool& instance() {
+        static MySharedPool* pool = new MySharedPool();
+        return *pool;
+    }
+
+    void* allocate() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pool.allocate();
+    }
+
+    void deallocate(void* p) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pool.deallocate(p);
+    }
+
+    // 一次取出 / 归还多个块，给线程本地缓存批量补货和退货用，一批只加一次锁
+    size_t allocate_batch(void** out, size_t n) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < n; ++i) out[i] = _pool.allocate();
+        return n;
+    }
+
+    void deallocate_batch(void** chunks, size_t n) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < n; ++i) _pool.deallocate(chunks[i]);
+    }
+
+    size_t slab_count() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pool.slab_count();
+    }
+};
+
+// 每个线程一份的空闲块缓存，放在 MySharedPool 前面。
+// 一个线程分配、另一个线程释放 (生产者-消费者) 也没问题：块只是进入释放线程的缓存，
+// 缓存太满时成批退回共享池，线程退出时全部退回。
+template <size_t ChunkSize, size_t ChunkAlign>
+class MyThreadCache {
+private:
+    static constexpr size_t CAPACITY = 256; // 本地最多缓存的块数
+    static constexpr size_t BATCH = 64;     // 每次向共享池补货 / 退货的块数
+
+    void* _chunks[CAPACITY];
+    size_t _count;
+
+    MyThreadCache() : _count(0) {}
+
+    ~MyThreadCache() {
+        MySharedPool<ChunkSize, ChunkAlign>::instance().deallocate_batch(_chunks, _count);
+        _count = 0;
+        _destroyed() = true;
+    }
+
+    // 线程退出后 (例如主线程里比缓存更晚析构的静态容器) 缓存已经不存在了，
+    // 用一个平凡类型的 thread_local 标记记住这一点，之后直接走共享池
+    static bool& _destroyed() {
+        thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static MyThreadCache& _local() {
+        thread_local MyThreadCache cache;
+        return cache;
+    }
+
+    void* _allocate() {
+        if (_count == 0) {
+            _count = MySharedPool<ChunkSize, ChunkAlign>::instance().allocate_batch(_chunks, BATCH);
+        }
+        return _chunks[--_count];
+    }
+
+    void _deallocate(void* p) {
+        if (_count == CAPACITY) {
+            // 退回最早缓存的一批，留下最近释放的 (更可能还在 CPU 缓存里)
+            MySharedPool<ChunkSize, ChunkAlign>::instance().deallocate_batch(_chunks, BATCH);
+            for (size_t i = BATCH; i < CAPACITY; ++i) _chunks[i - BATCH] = _chunks[i];
+            _count -= BATCH;
+        }
+        _chunks[_count++] = p;
+    }
+
+public:
+    static void* allocate() {
+        if (_destroyed()) return MySharedPool<ChunkSize, ChunkAlign>::instance().allocate();
+        return _local()._allocate();
+    }
+
+    static void deallocate(void* p) {
+        if (_destroyed()) {
+            MySharedPool<ChunkSize, ChunkAlign>::instance().deallocate(p);
+            return;
+        }
+        _local()._deallocate(p);
+    }
+};
+
+template <typename T, bool PerThreadCache = true>
+class MyPoolAllocator {
+private:
+    static constexpr size_t _align = alignof(T) < alignof(void*) ? alignof(void*) : alignof(T);
+    static constexpr size_t _size = sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T);
+
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = MyPoolAllocator<U, PerThreadCache>;
+    };
+
+    MyPoolAllocator() noexcept = default;
+    template <typename U>
+    MyPoolAllocator(const MyPoolAllocator<U, PerThreadCache>&) noexcept {}
+
+    T* allocate(size_t n) {
+        // 节点池只管单个对象；一次要多个对象 (容器一般不会这样用) 直接交给 operator new
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        }
+        if constexpr (PerThreadCache) {
+            return static_cast<T*>(MyThreadCache<_size, _align>::allocate());
+        }
+        else {
+            return static_cast<T*>(MySharedPool<_size, _align>::instance().allocate());
+        }
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (n != 1) {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+            return;
+        }
+        if constexpr (PerThreadCache) {
+            MyThreadCache<_size, _align>::deallocate(p);
+        }
+        else {
+            MySharedPool<_size, _align>::instance().deallocate(p);
+        }
+    }
+
+    // 当前块大小对应的共享池已经申请的 slab 数量 (测试 / 统计用)
+    static size_t pool_slab_count() {
+        return MySharedPool<_size, _align>::instance().slab_count();
+    }
+
+    // 无状态：任意两个实例分配的内存都可以互相释放
+    template <typename U>
+    bool operator==(const MyPoolAllocator<U, PerThreadCache>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const MyPoolAllocator<U, PerThreadCache>&) const noexcept { return false; }
+};
+
+#endif
@@ -1,20 +1,152 @@
 #ifndef MYSTL_MYQUEUE_NEW_H
 #define MYSTL_MYQUEUE_NEW_H
 
-#include "../MyStack.h"
-#include <iostream>
+#include "../MyVector.h"
+#include <cstddef>
+#include <stdexcept>
+#include <utility> // std::move, std::swap
 
+/*
+ * MyTwoStackQueue: 用两个栈实现的队列
+ *
+ * push 压入 _in 栈；pop 从 _out 栈顶弹出 (_out 的栈顶就是队头)。两个栈直接用 MyVector 的尾部充当栈顶。
+ *
+ * 转移方式 (MyTransferMode)：
+ *   Amortized   : _out 空了才整体转移。转移不再逐个 top() / pop() 拷贝，而是把 _in 的缓冲区整个交给 _out，
+ *                 再原地反转一遍 (n / 2 次 swap，不分配内存)；_in 接手 _out 空出来的缓冲区，两块内存来回复用。
+ *                 均摊 O(1)，但长串 push 之后的第一次 pop 是 O(n)。
+ *   Incremental : 每次 push / pop 都顺带做几步转移，把 O(n) 的工作摊到后续操作里，单次操作最坏 O(1)。
+ *                 一旦 |_in| > |_out| 就开始一轮转移：
+ *                   1. 冻结当前的 _in (_frozen)，新的 push 进入新的 _in；
+ *                   2. 逐个把 _frozen 的栈顶移到 _next (于是 _next 自底向上是队尾到队头的顺序)；
+ *                   3. 再把旧 _out 中尚未弹出的元素自底向上移到 _next 之上；期间 pop 照常从旧 _out 的栈顶取；
+ *                   4. 完成后 _next 成为新的 _out。
+ *                 从 |_in| = |_out| + 1 开始，旧 _out 被弹空之前总共要移动 2|_out| + 1 个元素，
+ *                 每次操作做 TRANSFER_STEPS (4) 步就一定来得及。
+ *                 (底层 MyVector 扩容本身仍是均摊的，对延迟敏感时先调用 reserve。)
+ */
+enum class MyTransferMode {
+    Amortized,
+    Incremental
+};
 
-class MyQueue {
+template <typename T>
+class MyTwoStackQueue {
 private:
-    MyStack<char> s1;
-    MyStack<char> s2;
+    static constexpr int TRANSFER_STEPS = 4;
+
+    MyVector<T> _in;     // 入队栈
+    MyVector<T> _out;    // 出队栈，back() 是队头
+    MyTransferMode _mode;
+
+    // --- 仅 Incremental 模式使用 ---
+    MyVector<T> _frozen; // 正在转移的旧 _in
+    MyVector<T> _next;   // 正在构建的新 _out
+    bool _transferring = false;
+    size_t _moved = 0;   // 已从 _frozen 移到 _next 的元素个数
+    size_t _copied = 0;  // 已从旧 _out 移到 _next 的元素个数 (_out[0, _copied) 已被移走)
+
+    // Amortized：整体交换缓冲区，再原地反转
+    void _bulk_transfer() {
+        std::swap(_in, _out);
+        for (size_t i = 0, j = _out.size(); i + 1 < j; ++i, --j) {
+            std::swap(_out[i], _out[j - 1]);
+        }
+    }
+
+    void _start_transfer() {
+        std::swap(_frozen, _in); // _in 接手 _frozen 上一轮留下的空缓冲区
+        _transferring = true;
+    }
+
+    void _transfer_step();
+
+    void _after_operation() {
+        if (_mode != MyTransferMode::Incremental) return;
+        if (!_transferring && _in.size() > _out.size()) {
+            _start_transfer();
+        }
+        for (int i = 0; i < TRANSFER_STEPS && _transferring; ++i) {
+            _transfer_step();
+        }
+    }
+
+    // 保证 _out 非空时栈顶就是队头
+    void _prepare_front() {
+        if (!_out.empty()) return;
+        if (_transferring) {
+            while (_transferring) _transfer_step();
+        }
+        else if (!_in.empty()) {
+            _bulk_transfer();
+        }
+        if (_out.empty()) throw std::out_of_range("The Queue is Empty!");
+    }
 
 public:
-    MyQueue();
-    void push(char c);
-    char pop();
-    int size() const;
+    explicit MyTwoStackQueue(MyTransferMode mode = MyTransferMode::Amortized) : _mode(mode) {}
+
+    size_t size() const { return _in.size() + _out.size() + _frozen.size() + _moved; }
+    bool empty() const { return size() == 0; }
+    MyTransferMode mode() const { return _mode; }
+
+    // 为最多 n 个元素预留所有栈的容量，之后的 push / pop / 转移都不会再分配内存
+    void reserve(size_t n) {
+        _in.reserve(n);
+        _out.reserve(n);
+        if (_mode == MyTransferMode::Incremental) {
+            _frozen.reserve(n);
+            _next.reserve(n);
+        }
+    }
+
+    void push(const T& value) {
+        _in.push_back(value);
+        _after_operation();
+    }
+
+    void push(T&& value) {
+        _in.push_back(std::move(value));
+        _after_operation();
+    }
+
+    // 弹出并返回队头 (移动出来，不拷贝)；队列为空时抛出 std::out_of_range
+    T pop() {
+        _prepare_front();
+        T result = std::move(_out.back());
+        _out.pop_back();
+        _after_operation();
+        return result;
+    }
+
+    T& front() {
+        _prepare_front();
+        return _out.back();
+    }
 };
 
-#endif // MYSTL_MYQUEUE_NEW_H
\ No newline at end of file
+template <typename T>
+void MyTwoStackQueue<T>::_transfer_step() {
+    // 阶段 2：反转 _frozen
+    if (!_frozen.empty()) {
+        _next.push_back(std::move(_frozen.back()));
+        _frozen.pop_back();
+        _moved++;
+        return;
+    }
+    // 阶段 3：旧 _out 自底向上移到 _next 之上。
+    // 一追上 _out.size() 就立刻完成，所以转移期间总有 _copied < _out.size()，pop 只会取走还没移动的元素
+    if (_copied < _out.size()) {
+        _next.push_back(std::move(_out[_copied]));
+        _copied++;
+        if (_copied < _out.size()) return;
+    }
+    // 阶段 4：旧 _out 剩下的元素都已经在 _next 的栈顶了
+    std::swap(_out, _next);
+    _next.clear(); // 旧 _out 里只剩被移走的空壳，保留缓冲区给下一轮
+    _transferring = false;
+    _moved = 0;
+    _copied = 0;
+}
+
+#endif // MYSTL_MYQUEUE_NEW_H
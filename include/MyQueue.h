@@ -1,13 +1,21 @@
 #ifndef MYQUEUE_H
 #define MYQUEUE_H
 
-#include "MyLinkedList.h" // <-- 底层容器是 MyLinkedList
+#include "MyLinkedList.h" // <-- 默认的底层容器是 MyLinkedList
 #include <cstddef>
+#include <stdexcept>
 
-template <typename T>
+/*
+ * 和 std::queue 一样，MyQueue 只是一个适配器，底层容器可以替换，
+ * 只要提供 push_back / pop_front / front / back / size / empty 即可：
+ *   MyQueue<T>                   : MyLinkedList，每次入队 new 一个节点，出队 delete
+ *   MyQueue<T, MyRingBuffer<T>>  : 环形缓冲区，队列深度稳定时不分配内存 (见 MyRingBuffer.h)
+ *   MyQueue<T, MyDeque<T>>       : 分块数组
+ */
+template <typename T, typename Container = MyLinkedList<T>>
 class MyQueue {
 private:
-    MyLinkedList<T> _container;
+    Container _container;
 
 public:
     MyQueue() {}
@@ -22,7 +30,7 @@ public:
 
     // front(): 查看队头元素
     T& front() {
-        // 队头对应 MyLinkedList 的_head
+        // 队头对应底层容器的 front (MyLinkedList 的 _head)
         if (empty()) throw std::out_of_range("The Queue is Empty!");
         return _container.front();
     }
@@ -33,7 +41,7 @@ public:
 
     // back(): 查看队尾元素
     T& back() {
-        // 队尾对应 MyLinkedList 的_tail
+        // 队尾对应底层容器的 back (MyLinkedList 的 _tail)
         if (empty()) throw std::out_of_range("The Queue is Empty!");
         return _container.back();
     }
@@ -44,13 +52,13 @@ public:
 
     // push(value): 在队尾入队
     void push(const T& value) {
-        // 入队对应 MyLinkedList 的push_back
+        // 入队对应底层容器的 push_back
         _container.push_back(value);
     }
 
     // pop(): 在队头出队
     void pop() {
-        // 出队对应 MyLinkedList 的pop_front
+        // 出队对应底层容器的 pop_front
         if (empty()) throw std::out_of_range("The Queue is Empty!");
         _container.pop_front();
     }
@@ -0,0 +1,197 @@
+#ifndef MYRINGBUFFER_H
+#define MYRINGBUFFER_H
+
+#include <cstddef>
+#include <new>         // placement new
+#include <stdexcept>   // std::out_of_range
+#include <type_traits>
+#include <utility>     // std::move, std::move_if_noexcept
+
+/*
+ * MyRingBuffer: 可扩容的环形缓冲区 (circular buffer)
+ *
+ * 元素放在一块连续的内存里，_head 指向队头，队尾在 (_head + _size) 处，走到数组末尾就绕回开头：
+ *   - 容量总是 2 的幂，下标用 (i & (capacity - 1)) 代替取模；
+ *   - push_back / pop_front / push_front / pop_back 都是 O(1)，队列深度稳定时完全不分配内存；
+ *   - 满了之后容量翻倍，把元素按逻辑顺序移动 (不是拷贝) 到新数组的开头。
+ *
+ * 提供 MyQueue 需要的全部接口 (push_back / pop_front / front / back / size / empty)，
+ * 可以作为 MyQueue 的底层容器：MyQueue<T, MyRingBuffer<T>>。
+ */
+template <typename T>
+class MyRingBuffer {
+private:
+    T* _data;
+    size_t _capacity; // 0 或 2 的幂
+    size_t _head;     // 队头元素的物理下标
+    size_t _size;
+
+    size_t _mask() const { return _capacity - 1; }
+    T* _slot(size_t logical_index) const { return _data + ((_head + logical_index) & _mask()); }
+
+    static T* _allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T))); }
+
+    void _grow_to(size_t new_capacity);
+
+public:
+    MyRingBuffer() : _data(nullptr), _capacity(0), _head(0), _size(0) {}
+
+    explicit MyRingBuffer(size_t initial_capacity) : MyRingBuffer() {
+        reserve(initial_capacity);
+    }
+
+    MyRingBuffer(const MyRingBuffer& other) : MyRingBuffer() {
+        reserve(other._size);
+        for (size_t i = 0; i < other._size; ++i) push_back(other[i]);
+    }
+
+    MyRingBuffer& operator=(const MyRingBuffer& other) {
+        if (this != &other) {
+            MyRingBuffer copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    MyRingBuffer(MyRingBuffer&& other) noexcept
+        : _data(other._data), _capacity(other._capacity), _head(other._head), _size(other._size)
+    {
+        other._data = nullptr;
+        other._capacity = other._head = other._size = 0;
+    }
+
+    MyRingBuffer& operator=(MyRingBuffer&& other) noexcept {
+        if (this != &other) {
+            MyRingBuffer moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~MyRingBuffer() {
+        clear();
+        ::operator delete(_data);
+    }
+
+    void swap(MyRingBuffer& other) noexcept {
+        std::swap(_data, other._data);
+        std::swap(_capacity, other._capacity);
+        std::swap(_head, other._head);
+        std::swap(_size, other._size);
+    }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    size_t capacity() const { return _capacity; }
+
+    // 保证至少能放下 n 个元素而不扩容 (容量向上取整到 2 的幂)
+    void reserve(size_t n) {
+        if (n <= _capacity) return;
+        size_t new_capacity = _capacity == 0 ? 1 : _capacity;
+        while (new_capacity < n) new_capacity <<= 1;
+        _grow_to(new_capacity);
+    }
+
+    void push_back(const T& value) {
+        if (_size == _capacity) {
+            // value 可能引用着缓冲区里的元素，先拷贝一份再扩容
+            T copy(value);
+            _grow_to(_capacity == 0 ? 8 : _capacity * 2);
+            ::new (_slot(_size)) T(std::move(copy));
+        }
+        else {
+            ::new (_slot(_size)) T(value);
+        }
+        _size++;
+    }
+
+    void push_back(T&& value) {
+        if (_size == _capacity) {
+            T moved(std::move(value));
+            _grow_to(_capacity == 0 ? 8 : _capacity * 2);
+            ::new (_slot(_size)) T(std::move(moved));
+        }
+        else {
+            ::new (_slot(_size)) T(std::move(value));
+        }
+        _size++;
+    }
+
+    void push_front(const T& value) {
+        if (_size == _capacity) {
+            T copy(value);
+            _grow_to(_capacity == 0 ? 8 : _capacity * 2);
+            _head = (_head - 1) & _mask();
+            ::new (_data + _head) T(std::move(copy));
+        }
+        else {
+            size_t new_head = (_head - 1) & _mask();
+            ::new (_data + new_head) T(value);
+            _head = new_head;
+        }
+        _size++;
+    }
+
+    void pop_front() {
+        if (empty()) {
+            throw std::out_of_range("Popping front on empty ring buffer");
+        }
+        _data[_head].~T();
+        _head = (_head + 1) & _mask();
+        _size--;
+    }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("Popping back on empty ring buffer");
+        }
+        _slot(_size - 1)->~T();
+        _size--;
+    }
+
+    T& front() {
+        if (empty()) throw std::out_of_range("Accessing front on empty ring buffer");
+        return _data[_head];
+    }
+    const T& front() const {
+        if (empty()) throw std::out_of_range("Accessing front on empty ring buffer");
+        return _data[_head];
+    }
+    T& back() {
+        if (empty()) throw std::out_of_range("Accessing back on empty ring buffer");
+        return *_slot(_size - 1);
+    }
+    const T& back() const {
+        if (empty()) throw std::out_of_range("Accessing back on empty ring buffer");
+        return *_slot(_size - 1);
+    }
+
+    // 按逻辑下标访问，0 是队头
+    T& operator[](size_t index) { return *_slot(index); }
+    const T& operator[](size_t index) const { return *_slot(index); }
+
+    void clear() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < _size; ++i) _slot(i)->~T();
+        }
+        _head = 0;
+        _size = 0;
+    }
+};
+
+template <typename T>
+void MyRingBuffer<T>::_grow_to(size_t new_capacity) {
+    T* new_data = _allocate(new_capacity);
+    // 按逻辑顺序把元素搬到新数组的 [0, _size)，绕回的那一段也因此被“拉直”
+    for (size_t i = 0; i < _size; ++i) {
+        T* src = _slot(i);
+        ::new (new_data + i) T(std::move_if_noexcept(*src));
+        src->~T();
+    }
+    ::operator delete(_data);
+    _data = new_data;
+    _capacity = new_capacity;
+    _head = 0;
+}
+
+#endif
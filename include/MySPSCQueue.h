@@ -0,0 +1,301 @@
+#ifndef MYSPSCQUEUE_H
+#define MYSPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>        // placement new
+#include <thread>     // std::this_thread::yield
+#include <utility>    // std::move
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * MySPSCQueue: 单生产者 / 单消费者 (SPSC) 的无锁有界队列
+ *
+ * 只有一个线程 push、一个线程 pop 时，不需要任何锁或 CAS：
+ *   - 固定容量的环形数组 (容量是 2 的幂，下标用位与)；
+ *   - _tail 只由生产者写，_head 只由消费者写，两者都是单调递增的计数，满 / 空由它们的差值判断；
+ *   - 生产者发布元素用 release 写 _tail，消费者用 acquire 读 _tail，保证读到的元素是完整的 (反之亦然)。
+ *
+ * 两个关键优化：
+ *   1. _head 和 _tail 各占一条缓存行，避免生产者和消费者互相使对方的缓存行失效 (伪共享)；
+ *   2. 生产者缓存一份“上次看到的 _head” (_head_cache)，只有在看起来满了的时候才去读真正的 _head，
+ *      消费者对 _tail 同理。队列不满不空时，一次 push / pop 只碰自己那条缓存行。
+ *
+ * try_push / try_pop 从不阻塞；push / pop 在队列满 / 空时等待，等待方式由 MyWaitStrategy 决定：
+ *   Spin  : 忙等 (先 pause，再 yield)，延迟最低，但会一直占着 CPU；
+ *   Block : 先自旋一小会儿，然后在 futex 上睡眠，由对方唤醒 (非 Linux 平台退化为 yield)。
+ */
+enum class MyWaitStrategy {
+    Spin,
+    Block
+};
+
+// 等待时的 CPU 提示：告诉处理器这是一个自旋循环，降低功耗并让出流水线资源给超线程
+inline void my_cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// futex 等待 / 唤醒：*addr 仍然等于 expected 时睡眠，直到被 my_futex_wake 唤醒 (最多唤醒 count 个线程)
+inline void my_futex_wait(std::atomic<uint32_t>* addr, uint32_t expected) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    if (addr->load(std::memory_order_acquire) == expected) std::this_thread::yield();
+#endif
+}
+
+inline void my_futex_wake(std::atomic<uint32_t>* addr, int count = 1) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+    (void)addr;
+    (void)count;
+#endif
+}
+
+constexpr int MY_SPIN_BEFORE_YIELD = 64;   // 忙等多少次之后开始 yield
+constexpr int MY_SPIN_BEFORE_SLEEP = 256;  // Block 模式下自旋多少次之后去睡眠
+
+// 按 MyWaitStrategy 等待 ready() 变为 true：先 pause，再 yield；Block 模式下自旋够了就调用 sleep()，
+// 由 sleep 负责登记自己、再检查一次 ready()、然后在 futex 上睡眠 (各个队列登记的方式不同)。
+// 计数停在 MY_SPIN_BEFORE_SLEEP：Spin 模式下可能空等任意久，一直加下去会溢出
+template <typename Ready, typename Sleep>
+void my_wait_until(MyWaitStrategy wait, Ready ready, Sleep sleep) {
+    int spin = 0;
+    while (!ready()) {
+        if (spin < MY_SPIN_BEFORE_SLEEP || wait == MyWaitStrategy::Spin) {
+            if (spin < MY_SPIN_BEFORE_YIELD) my_cpu_relax();
+            else std::this_thread::yield();
+            if (spin < MY_SPIN_BEFORE_SLEEP) ++spin;
+            continue;
+        }
+        sleep();
+    }
+}
+
+template <typename T>
+class MySPSCQueue {
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    // 一个等待方向 (等“非空”或者等“非满”) 所需的状态
+    struct alignas(CACHE_LINE) Waiter {
+        std::atomic<uint32_t> epoch{0};    // futex 字：对方每次唤醒前加一
+        std::atomic<bool> waiting{false};  // 是否有线程 (可能) 在睡眠
+    };
+
+    // --- 生产者独占的缓存行 ---
+    alignas(CACHE_LINE) std::atomic<size_t> _tail;  // 下一个要写入的位置
+    size_t _head_cache;                              // 生产者看到的 _head
+
+    // --- 消费者独占的缓存行 ---
+    alignas(CACHE_LINE) std::atomic<size_t> _head;  // 下一个要读取的位置
+    size_t _tail_cache;                              // 消费者看到的 _tail
+
+    // --- 只读的部分 ---
+    alignas(CACHE_LINE) T* _slots;
+    size_t _capacity;
+    size_t _mask;
+    MyWaitStrategy _wait;
+
+    Waiter _not_empty; // 消费者在这里等
+    Waiter _not_full;  // 生产者在这里等
+
+    static size_t _round_up_pow2(size_t n) {
+        size_t count = 2;
+        while (count < n) count <<= 1;
+        return count;
+    }
+
+    // 生产者：当前空位个数 (只有缓存的 _head 显示已满时才去读真正的 _head)
+    size_t _free_slots(size_t tail) {
+        size_t free = _capacity - (tail - _head_cache);
+        if (free == 0) {
+            _head_cache = _head.load(std::memory_order_acquire);
+            free = _capacity - (tail - _head_cache);
+        }
+        return free;
+    }
+
+    // 消费者：当前可读的元素个数
+    size_t _ready_items(size_t head) {
+        size_t ready = _tail_cache - head;
+        if (ready == 0) {
+            _tail_cache = _tail.load(std::memory_order_acquire);
+            ready = _tail_cache - head;
+        }
+        return ready;
+    }
+
+    // 等待条件：用真实的 _head / _tail 判断，不更新缓存
+    bool _has_space() const {
+        return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire) < _capacity;
+    }
+    bool _has_items() const {
+        return _tail.load(std::memory_order_acquire) != _head.load(std::memory_order_relaxed);
+    }
+
+    // 状态改变之后，如果对方可能在睡眠就唤醒它
+    void _notify(Waiter& waiter) {
+        if (_wait != MyWaitStrategy::Block) return;
+        // 与 _wait_until 中的 fence 配对：要么对方看到了我们刚发布的数据，要么我们看到了它的 waiting 标记
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiter.waiting.load(std::memory_order_relaxed)) {
+            waiter.epoch.fetch_add(1, std::memory_order_release);
+            my_futex_wake(&waiter.epoch);
+        }
+    }
+
+    // 等待 ready() 变为 true
+    template <typename Ready>
+    void _wait_until(Waiter& waiter, Ready ready) {
+        my_wait_until(_wait, ready, [&waiter, &ready] {
+            uint32_t epoch = waiter.epoch.load(std::memory_order_acquire);
+            waiter.waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!ready()) {
+                my_futex_wait(&waiter.epoch, epoch);
+            }
+            waiter.waiting.store(false, std::memory_order_relaxed);
+        });
+    }
+
+public:
+    // capacity 会被向上取整到 2 的幂 (至少为 2)
+    explicit MySPSCQueue(size_t capacity, MyWaitStrategy wait = MyWaitStrategy::Spin)
+        : _tail(0), _head_cache(0), _head(0), _tail_cache(0), _wait(wait)
+    {
+        _capacity = _round_up_pow2(capacity);
+        _mask = _capacity - 1;
+        _slots = static_cast<T*>(::operator new(_capacity * sizeof(T)));
+    }
+
+    ~MySPSCQueue() {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        for (size_t i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+            _slots[i & _mask].~T();
+        }
+        ::operator delete(_slots);
+    }
+
+    MySPSCQueue(const MySPSCQueue&) = delete;
+    MySPSCQueue& operator=(const MySPSCQueue&) = delete;
+
+    // ------------------- 生产者接口 (只能由一个线程调用) -------------------
+
+    bool try_push(const T& value) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (_free_slots(tail) == 0) return false;
+        ::new (&_slots[tail & _mask]) T(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        _notify(_not_empty);
+        return true;
+    }
+
+    bool try_push(T&& value) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (_free_slots(tail) == 0) return false;
+        ::new (&_slots[tail & _mask]) T(std::move(value));
+        _tail.store(tail + 1, std::memory_order_release);
+        _notify(_not_empty);
+        return true;
+    }
+
+    // 批量入队：尽量写入 items[0, n)，返回实际写入的个数。整批只发布一次 _tail
+    size_t try_push_bulk(const T* items, size_t n) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        size_t free = _capacity - (tail - _head_cache);
+        if (free < n) {
+            _head_cache = _head.load(std::memory_order_acquire);
+            free = _capacity - (tail - _head_cache);
+        }
+        size_t count = n < free ? n : free;
+        for (size_t i = 0; i < count; ++i) {
+            ::new (&_slots[(tail + i) & _mask]) T(items[i]);
+        }
+        if (count > 0) {
+            _tail.store(tail + count, std::memory_order_release);
+            _notify(_not_empty);
+        }
+        return count;
+    }
+
+    // 阻塞入队：队列满时按等待策略等待
+    void push(const T& value) {
+        while (!try_push(value)) {
+            _wait_until(_not_full, [this] { return _has_space(); });
+        }
+    }
+
+    // try_push 失败时不会移动 value，所以可以反复重试
+    void push(T&& value) {
+        while (!try_push(std::move(value))) {
+            _wait_until(_not_full, [this] { return _has_space(); });
+        }
+    }
+
+    // ------------------- 消费者接口 (只能由一个线程调用) -------------------
+
+    bool try_pop(T& out) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (_ready_items(head) == 0) return false;
+        T* slot = &_slots[head & _mask];
+        out = std::move(*slot);
+        slot->~T();
+        _head.store(head + 1, std::memory_order_release);
+        _notify(_not_full);
+        return true;
+    }
+
+    // 批量出队：最多取 n 个到 out[0, n)，返回实际取出的个数。整批只发布一次 _head
+    size_t try_pop_bulk(T* out, size_t n) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t ready = _tail_cache - head;
+        if (ready < n) {
+            _tail_cache = _tail.load(std::memory_order_acquire);
+            ready = _tail_cache - head;
+        }
+        size_t count = n < ready ? n : ready;
+        for (size_t i = 0; i < count; ++i) {
+            T* slot = &_slots[(head + i) & _mask];
+            out[i] = std::move(*slot);
+            slot->~T();
+        }
+        if (count > 0) {
+            _head.store(head + count, std::memory_order_release);
+            _notify(_not_full);
+        }
+        return count;
+    }
+
+    // 阻塞出队：队列空时按等待策略等待
+    void pop(T& out) {
+        while (!try_pop(out)) {
+            _wait_until(_not_empty, [this] { return _has_items(); });
+        }
+    }
+
+    // ------------------- 任意线程 -------------------
+
+    // 并发修改时只是一个近似值
+    size_t size_approx() const {
+        size_t tail = _tail.load(std::memory_order_acquire);
+        size_t head = _head.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool empty_approx() const { return size_approx() == 0; }
+    size_t capacity() const { return _capacity; }
+};
+
+#endif
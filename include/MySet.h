@@ -2,11 +2,15 @@
 #define MYSTL_MYSET_H
 
 #include "MyBST.h"
+#include "MyAVLTree.h"
+#include <utility>
 
-template <typename T>
+// Tree 是底层的树引擎：默认的 MyBST 不做平衡，键按顺序到达时会退化成链表；
+// 需要稳定的 O(log n) 时用 MyAVLTree：MySet<int, MyAVLTree>
+template <typename T, template <typename> class Tree = MyBST>
 class MySet {
 private:
-    MyBST<T> _tree;
+    Tree<T> _tree;
 
 public:
     void insert(const T& value);
@@ -15,36 +19,69 @@ public:
     size_t size() const;
     bool empty() const;
     void clear();
+
+    // 用升序的区间 [first, last) 替换集合的内容，O(n) 建出平衡的树 (比逐个 insert 快得多)。
+    // 相邻的重复元素只保留一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last) { _tree.build_from_sorted(first, last); }
+
+    // 顺序统计：第 k 小的元素 (k 从 0 开始，越界返回 nullptr)、严格小于 value 的元素个数、[lo, hi) 中的元素个数
+    const T* select(size_t k) const;
+    size_t rank(const T& value) const;
+    size_t count_in_range(const T& lo, const T& hi) const;
+
+    // 区间查询 [lo, hi)，只访问和区间有交集的子树，O(log n + k)：
+    // range 返回一对迭代器 (可以直接 range-for)；for_each_in_range 对每个元素调用 visit，visit 返回 false 时提前结束
+    auto range(const T& lo, const T& hi) const { return _tree.range(lo, hi); }
+    template <typename Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor&& visit) const {
+        _tree.for_each_in_range(lo, hi, std::forward<Visitor>(visit));
+    }
 };
 
-template<typename T>
-void MySet<T>::insert(const T &value) {
+template<typename T, template <typename> class Tree>
+void MySet<T, Tree>::insert(const T &value) {
     _tree.insert(value);
 }
 
-template<typename T>
-bool MySet<T>::contains(const T &value) const {
+template<typename T, template <typename> class Tree>
+bool MySet<T, Tree>::contains(const T &value) const {
     return _tree.find(value);
 }
 
-template<typename T>
-void MySet<T>::erase(const T &value) {
+template<typename T, template <typename> class Tree>
+void MySet<T, Tree>::erase(const T &value) {
     _tree.remove(value);
 }
 
-template<typename T>
-size_t MySet<T>::size() const {
+template<typename T, template <typename> class Tree>
+size_t MySet<T, Tree>::size() const {
     return _tree.size();
 }
 
-template<typename T>
-bool MySet<T>::empty() const {
+template<typename T, template <typename> class Tree>
+bool MySet<T, Tree>::empty() const {
     return _tree.empty();
 }
 
-template<typename T>
-void MySet<T>::clear() {
+template<typename T, template <typename> class Tree>
+void MySet<T, Tree>::clear() {
     _tree.clear();
 }
 
+template<typename T, template <typename> class Tree>
+const T *MySet<T, Tree>::select(size_t k) const {
+    return _tree.select(k);
+}
+
+template<typename T, template <typename> class Tree>
+size_t MySet<T, Tree>::rank(const T &value) const {
+    return _tree.rank(value);
+}
+
+template<typename T, template <typename> class Tree>
+size_t MySet<T, Tree>::count_in_range(const T &lo, const T &hi) const {
+    return _tree.count_in_range(lo, hi);
+}
+
 #endif //MYSTL_MYSET_H
\ No newline at end of file
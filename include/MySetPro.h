@@ -2,6 +2,7 @@
 #define MYSTL_MYSETPRO_H
 
 #include "MyTreap.h"
+#include <utility>
 
 template <typename T>
 class MySetPro {
@@ -15,6 +16,24 @@ public:
     size_t size() const;
     bool empty() const;
     void clear();
+
+    // 用升序的区间 [first, last) 替换集合的内容，O(n) 建出平衡的树 (比逐个 insert 快得多)。
+    // 相邻的重复元素只保留一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last) { _tree.build_from_sorted(first, last); }
+
+    // 顺序统计：第 k 小的元素 (k 从 0 开始，越界返回 nullptr)、严格小于 value 的元素个数、[lo, hi) 中的元素个数
+    const T* select(size_t k) const;
+    size_t rank(const T& value) const;
+    size_t count_in_range(const T& lo, const T& hi) const;
+
+    // 区间查询 [lo, hi)，只访问和区间有交集的子树，O(log n + k)：
+    // range 返回一对迭代器 (可以直接 range-for)；for_each_in_range 对每个元素调用 visit，visit 返回 false 时提前结束
+    auto range(const T& lo, const T& hi) const { return _tree.range(lo, hi); }
+    template <typename Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor&& visit) const {
+        _tree.for_each_in_range(lo, hi, std::forward<Visitor>(visit));
+    }
 };
 
 template<typename T>
@@ -47,4 +66,19 @@ void MySetPro<T>::clear() {
     _tree.clear();
 }
 
+template<typename T>
+const T *MySetPro<T>::select(size_t k) const {
+    return _tree.select(k);
+}
+
+template<typename T>
+size_t MySetPro<T>::rank(const T &value) const {
+    return _tree.rank(value);
+}
+
+template<typename T>
+size_t MySetPro<T>::count_in_range(const T &lo, const T &hi) const {
+    return _tree.count_in_range(lo, hi);
+}
+
 #endif //MYSTL_MYSETPRO_H
\ No newline at end of file
@@ -0,0 +1,160 @@
+#ifndef MYSMALLSTACK_H
+#define MYSMALLSTACK_H
+
+#include <cstddef>
+#include <new>         // placement new
+#include <stdexcept>   // std::out_of_range
+#include <type_traits>
+#include <utility>     // std::move, std::forward, std::move_if_noexcept
+
+/*
+ * MySmallStack: 带内联缓冲区的栈 (small buffer optimization)
+ *
+ * MyStack 建立在 MyVector 上，第一次 push 就要分配内存，之后按 1, 2, 4, 8... 扩容。
+ * 表达式求值、树的迭代遍历这类场景会创建大量短命的小栈，每个栈只放几个元素，分配本身成了主要开销。
+ *
+ * MySmallStack 在对象内部预留 N 个元素的空间：
+ *   - 元素个数不超过 N 时完全不分配内存，放在局部变量里就是纯粹的栈上内存；
+ *   - 超过 N 时才“溢出”到堆上 (容量翻倍)，之后的行为和 MyStack 一样。
+ * 接口与 MyStack 相同 (push / pop / top / size / empty)，可以直接替换。
+ */
+template <typename T, size_t N = 16>
+class MySmallStack {
+    static_assert(N > 0, "MySmallStack needs at least one inline slot");
+
+private:
+    alignas(T) unsigned char _inline[N * sizeof(T)]; // 内联缓冲区
+    T* _data;          // 指向 _inline 或堆上的缓冲区
+    size_t _size;
+    size_t _capacity;
+
+    T* _inline_data() { return reinterpret_cast<T*>(_inline); }
+    bool _is_inline() const { return _data == reinterpret_cast<const T*>(_inline); }
+
+    // 把元素搬到容量为 new_capacity 的堆缓冲区
+    void _grow(size_t new_capacity) {
+        T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        for (size_t i = 0; i < _size; ++i) {
+            ::new (new_data + i) T(std::move_if_noexcept(_data[i]));
+            _data[i].~T();
+        }
+        _release();
+        _data = new_data;
+        _capacity = new_capacity;
+    }
+
+    void _release() {
+        if (!_is_inline()) ::operator delete(_data);
+    }
+
+    // 从 other 取走全部元素 (调用前自己必须是空的)。
+    // 对方在堆上时直接接管缓冲区；在内联缓冲区里时只能逐个移动元素
+    void _take(MySmallStack& other) {
+        if (!other._is_inline()) {
+            _release();
+            _data = other._data;
+            _capacity = other._capacity;
+            _size = other._size;
+            other._data = other._inline_data();
+            other._capacity = N;
+            other._size = 0;
+            return;
+        }
+        // other 的元素不超过 N 个，自己的容量一定放得下
+        for (size_t i = 0; i < other._size; ++i) {
+            ::new (_data + i) T(std::move(other._data[i]));
+            _size++;
+        }
+        other.clear();
+    }
+
+    void _destroy_all() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < _size; ++i) _data[i].~T();
+        }
+        _size = 0;
+    }
+
+public:
+    MySmallStack() : _data(_inline_data()), _size(0), _capacity(N) {}
+
+    MySmallStack(const MySmallStack& other) : MySmallStack() {
+        if (other._size > N) _grow(other._size);
+        for (size_t i = 0; i < other._size; ++i) {
+            ::new (_data + i) T(other._data[i]);
+            _size++;
+        }
+    }
+
+    MySmallStack(MySmallStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : MySmallStack()
+    {
+        _take(other);
+    }
+
+    MySmallStack& operator=(const MySmallStack& other) {
+        if (this != &other) {
+            MySmallStack copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    MySmallStack& operator=(MySmallStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            _destroy_all();
+            _take(other);
+        }
+        return *this;
+    }
+
+    ~MySmallStack() {
+        _destroy_all();
+        _release();
+    }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    size_t capacity() const { return _capacity; }
+    static constexpr size_t inline_capacity() { return N; }
+
+    // 元素是否还放在对象内部 (没有溢出到堆上)
+    bool is_inline() const { return _is_inline(); }
+
+    T& top() {
+        if (empty()) throw std::out_of_range("The Stack is Empty!");
+        return _data[_size - 1];
+    }
+
+    const T& top() const {
+        if (empty()) throw std::out_of_range("The Stack is Empty!");
+        return _data[_size - 1];
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (_size == _capacity) {
+            // 参数可能引用着栈里的元素，先构造出来再扩容
+            T value(std::forward<Args>(args)...);
+            _grow(_capacity * 2);
+            return *::new (_data + _size++) T(std::move(value));
+        }
+        return *::new (_data + _size++) T(std::forward<Args>(args)...);
+    }
+
+    // 与 MyStack 一致：空栈上 pop 什么也不做
+    void pop() {
+        if (_size > 0) {
+            _size--;
+            _data[_size].~T();
+        }
+    }
+
+    // 清空元素，保留已分配的容量
+    void clear() { _destroy_all(); }
+};
+
+#endif // MYSMALLSTACK_H
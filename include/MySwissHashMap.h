@@ -0,0 +1,388 @@
+#ifndef MYSWISSHASHMAP_H
+#define MYSWISSHASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>     // std::memset
+#include <functional>  // 需要 std::hash
+#include "MyHash.h"     // my_hash_mix
+#include <new>         // placement new
+#include <utility>     // std::move
+
+// 编译期开关：定义 MYSTL_SWISS_FORCE_SCALAR 可以彻底关闭 SIMD 路径
+#if defined(__SSE2__) && !defined(MYSTL_SWISS_FORCE_SCALAR)
+#include <emmintrin.h>
+#define MYSTL_SWISS_HAS_SSE2 1
+#else
+#define MYSTL_SWISS_HAS_SSE2 0
+#endif
+
+/*
+ * MySwissHashMap: “控制字节” 风格的开放寻址哈希表 (Swiss Table)
+ *
+ * 和 MyFlatHashMap 一样，所有键值对放在一块连续的数组中；不同的是，
+ * 另外维护一个 1 字节/槽位 的控制数组 _ctrl：
+ *   - kEmpty   (0x80): 空槽
+ *   - kDeleted (0xFE): 被删除的槽 (墓碑)
+ *   - 0 ~ 127       : 已占用，值为哈希值的低 7 位 (h2)
+ *
+ * 查找时先用哈希值的高位 (h1) 选出一个 16 槽位的“组”，然后一次性比较这 16 个控制字节：
+ *   只有 h2 相同的槽位才需要真正去比较 key。查找失败时，大多数情况下连 key 所在的内存都不用碰。
+ * 如果当前组里还有空槽，说明 key 不可能在更后面，查找结束；否则按二次探测跳到下一个组。
+ *
+ * 16 个字节的比较有两种实现：
+ *   - SSE2: 一条 _mm_cmpeq_epi8 + _mm_movemask_epi8
+ *   - 标量: 逐字节比较 (没有 SSE2 或者被运行时关闭时使用)
+ * 两者的结果完全一样，可以通过 set_simd_enabled() 在运行时切换，方便两条路径都被测试到。
+ */
+template <typename K, typename V>
+class MySwissHashMap {
+private:
+    struct Slot {
+        K key;
+        V value;
+        Slot(const K& k, const V& v) : key(k), value(v) {}
+    };
+
+    static constexpr int8_t kEmpty = static_cast<int8_t>(0x80);   // -128
+    static constexpr int8_t kDeleted = static_cast<int8_t>(0xFE); // -2
+    static constexpr size_t kGroupWidth = 16;
+
+    Slot* _slots;        // 原始内存，只有 _ctrl[i] >= 0 的位置才构造了对象
+    int8_t* _ctrl;       // 控制字节数组
+    size_t _capacity;    // 槽位数量，2 的幂且至少为一个组
+    size_t _size;
+    size_t _growth_left; // 还能往“空槽”里放多少个元素，用完就 rehash (墓碑也占用额度)
+    bool _use_simd;
+
+    // 打散后的哈希值：高位选组 (h1)，低 7 位作为控制字节 (h2)
+    static size_t _hash(const K& key) {
+        return my_hash_mix(std::hash<K>{}(key));
+    }
+    static size_t _h1(size_t hash) { return hash >> 7; }
+    static int8_t _h2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+    // 在一个组的 16 个控制字节中查找，返回 16 位的位图 (第 i 位为 1 表示第 i 个槽位匹配)
+    uint32_t _match(const int8_t* group, int8_t h2) const;
+    uint32_t _match_empty(const int8_t* group) const;
+    uint32_t _match_empty_or_deleted(const int8_t* group) const;
+
+    static size_t _max_load(size_t capacity) { return capacity - capacity / 8; } // 7/8 负载因子
+
+    size_t _find_index(const K& key) const; // 找不到时返回 _capacity
+    size_t _find_insert_slot(size_t hash) const;
+    size_t _insert_new(size_t hash, Slot&& slot);
+    void _rehash(size_t new_capacity);
+    void _allocate(size_t capacity);
+    void _release();
+
+public:
+    explicit MySwissHashMap(size_t bucket_count = 16);
+    MySwissHashMap(const MySwissHashMap& other);
+    MySwissHashMap& operator=(const MySwissHashMap& other);
+    MySwissHashMap(MySwissHashMap&& other) noexcept;
+    MySwissHashMap& operator=(MySwissHashMap&& other) noexcept;
+    ~MySwissHashMap() { _release(); }
+
+    void insert(const K& key, const V& value);
+    V& operator[](const K& key);
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    //根据 key 查找，如果找到了，返回一个指向 value 的指针；如果没找到，返回 nullptr。
+    V* find(const K& key);
+    const V* find(const K& key) const;
+
+    bool erase(const K& key);
+    void clear();
+
+    size_t bucket_count() const { return _capacity; }
+
+    // 运行时开关：关闭后即使编译了 SSE2 也走标量路径
+    static constexpr bool simd_available() { return MYSTL_SWISS_HAS_SSE2 != 0; }
+    void set_simd_enabled(bool enabled) { _use_simd = enabled && simd_available(); }
+    bool simd_enabled() const { return _use_simd; }
+};
+
+// ------------------- 组内匹配 (SIMD / 标量) -------------------
+
+template <typename K, typename V>
+uint32_t MySwissHashMap<K, V>::_match(const int8_t* group, int8_t h2) const {
+#if MYSTL_SWISS_HAS_SSE2
+    if (_use_simd) {
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+    }
+#endif
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        if (group[i] == h2) mask |= 1u << i;
+    }
+    return mask;
+}
+
+template <typename K, typename V>
+uint32_t MySwissHashMap<K, V>::_match_empty(const int8_t* group) const {
+#if MYSTL_SWISS_HAS_SSE2
+    if (_use_simd) {
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(kEmpty))));
+    }
+#endif
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        if (group[i] == kEmpty) mask |= 1u << i;
+    }
+    return mask;
+}
+
+template <typename K, typename V>
+uint32_t MySwissHashMap<K, V>::_match_empty_or_deleted(const int8_t* group) const {
+#if MYSTL_SWISS_HAS_SSE2
+    if (_use_simd) {
+        // kEmpty 和 kDeleted 是仅有的两个小于 -1 的控制字节
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+    }
+#endif
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        if (group[i] < -1) mask |= 1u << i;
+    }
+    return mask;
+}
+
+// ------------------- 内存管理 -------------------
+
+template <typename K, typename V>
+void MySwissHashMap<K, V>::_allocate(size_t capacity) {
+    size_t cap = kGroupWidth;
+    while (cap < capacity) cap <<= 1;
+    _capacity = cap;
+    _slots = static_cast<Slot*>(::operator new(cap * sizeof(Slot)));
+    _ctrl = new int8_t[cap];
+    std::memset(_ctrl, kEmpty, cap);
+    _growth_left = _max_load(cap);
+}
+
+template <typename K, typename V>
+void MySwissHashMap<K, V>::_release() {
+    if (_slots == nullptr) return;
+    for (size_t i = 0; i < _capacity; ++i) {
+        if (_ctrl[i] >= 0) _slots[i].~Slot();
+    }
+    ::operator delete(_slots);
+    delete[] _ctrl;
+    _slots = nullptr;
+    _ctrl = nullptr;
+    _capacity = 0;
+    _size = 0;
+    _growth_left = 0;
+}
+
+template <typename K, typename V>
+MySwissHashMap<K, V>::MySwissHashMap(size_t bucket_count)
+    : _slots(nullptr), _ctrl(nullptr), _capacity(0), _size(0), _growth_left(0),
+      _use_simd(simd_available())
+{
+    _allocate(bucket_count);
+}
+
+template <typename K, typename V>
+MySwissHashMap<K, V>::MySwissHashMap(const MySwissHashMap& other)
+    : _slots(nullptr), _ctrl(nullptr), _capacity(0), _size(0), _growth_left(0),
+      _use_simd(other._use_simd)
+{
+    _allocate(other._capacity);
+    if (other._ctrl == nullptr) return; // other 已经被移动过，得到一个空表即可
+
+    // 容量相同，所以每个元素可以原样拷贝到相同的位置
+    for (size_t i = 0; i < _capacity; ++i) {
+        if (other._ctrl[i] >= 0) {
+            new (_slots + i) Slot(other._slots[i]);
+        }
+    }
+    std::memcpy(_ctrl, other._ctrl, _capacity);
+    _size = other._size;
+    _growth_left = other._growth_left;
+}
+
+template <typename K, typename V>
+MySwissHashMap<K, V>& MySwissHashMap<K, V>::operator=(const MySwissHashMap& other) {
+    if (this == &other) return *this;
+    MySwissHashMap temp(other);
+    *this = std::move(temp);
+    return *this;
+}
+
+template <typename K, typename V>
+MySwissHashMap<K, V>::MySwissHashMap(MySwissHashMap&& other) noexcept
+    : _slots(other._slots), _ctrl(other._ctrl), _capacity(other._capacity), _size(other._size),
+      _growth_left(other._growth_left), _use_simd(other._use_simd)
+{
+    other._slots = nullptr;
+    other._ctrl = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    other._growth_left = 0;
+}
+
+template <typename K, typename V>
+MySwissHashMap<K, V>& MySwissHashMap<K, V>::operator=(MySwissHashMap&& other) noexcept {
+    if (this == &other) return *this;
+    _release();
+    _slots = other._slots;
+    _ctrl = other._ctrl;
+    _capacity = other._capacity;
+    _size = other._size;
+    _growth_left = other._growth_left;
+    _use_simd = other._use_simd;
+    other._slots = nullptr;
+    other._ctrl = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    other._growth_left = 0;
+    return *this;
+}
+
+// ------------------- 查找与插入 -------------------
+
+template <typename K, typename V>
+size_t MySwissHashMap<K, V>::_find_index(const K& key) const {
+    if (_capacity == 0) return _capacity;
+    const size_t hash = _hash(key);
+    const int8_t h2 = _h2(hash);
+    const size_t group_mask = _capacity / kGroupWidth - 1;
+    size_t group = _h1(hash) & group_mask;
+
+    // 二次探测：依次跳过 1, 2, 3 ... 个组，组数是 2 的幂时可以保证访问到所有组
+    for (size_t step = 1; step <= group_mask + 1; ++step) {
+        const int8_t* ctrl = _ctrl + group * kGroupWidth;
+        for (uint32_t mask = _match(ctrl, h2); mask != 0; mask &= mask - 1) {
+            size_t index = group * kGroupWidth + __builtin_ctz(mask);
+            if (_slots[index].key == key) {
+                return index;
+            }
+        }
+        // 组里还有空槽：key 如果存在，插入时就会放在这里，不可能在更后面
+        if (_match_empty(ctrl) != 0) {
+            return _capacity;
+        }
+        group = (group + step) & group_mask;
+    }
+    return _capacity;
+}
+
+template <typename K, typename V>
+size_t MySwissHashMap<K, V>::_find_insert_slot(size_t hash) const {
+    const size_t group_mask = _capacity / kGroupWidth - 1;
+    size_t group = _h1(hash) & group_mask;
+    for (size_t step = 1; ; ++step) {
+        uint32_t mask = _match_empty_or_deleted(_ctrl + group * kGroupWidth);
+        if (mask != 0) {
+            return group * kGroupWidth + __builtin_ctz(mask);
+        }
+        group = (group + step) & group_mask;
+    }
+}
+
+template <typename K, typename V>
+size_t MySwissHashMap<K, V>::_insert_new(size_t hash, Slot&& slot) {
+    size_t index = _find_insert_slot(hash);
+    // 复用墓碑不消耗 growth 额度，占用空槽才消耗
+    if (_ctrl[index] == kEmpty) {
+        _growth_left--;
+    }
+    new (_slots + index) Slot(std::move(slot));
+    _ctrl[index] = _h2(hash);
+    _size++;
+    return index;
+}
+
+template <typename K, typename V>
+void MySwissHashMap<K, V>::_rehash(size_t new_capacity) {
+    Slot* old_slots = _slots;
+    int8_t* old_ctrl = _ctrl;
+    size_t old_capacity = _capacity;
+
+    _allocate(new_capacity);
+    _size = 0;
+
+    // 把旧表中的元素 *移动* 到新表，顺便清除所有墓碑
+    for (size_t i = 0; i < old_capacity; ++i) {
+        if (old_ctrl[i] >= 0) {
+            _insert_new(_hash(old_slots[i].key), std::move(old_slots[i]));
+            old_slots[i].~Slot();
+        }
+    }
+    ::operator delete(old_slots);
+    delete[] old_ctrl;
+}
+
+template <typename K, typename V>
+V* MySwissHashMap<K, V>::find(const K& key) {
+    size_t index = _find_index(key);
+    return index == _capacity ? nullptr : &_slots[index].value;
+}
+
+template <typename K, typename V>
+const V* MySwissHashMap<K, V>::find(const K& key) const {
+    size_t index = _find_index(key);
+    return index == _capacity ? nullptr : &_slots[index].value;
+}
+
+template <typename K, typename V>
+void MySwissHashMap<K, V>::insert(const K& key, const V& value) {
+    (*this)[key] = value;
+}
+
+template <typename K, typename V>
+V& MySwissHashMap<K, V>::operator[](const K& key) {
+    size_t index = _find_index(key);
+    if (index != _capacity) {
+        return _slots[index].value;
+    }
+
+    if (_growth_left == 0) {
+        // 如果大部分额度是被墓碑占用的，原地 rehash 清理墓碑即可；否则容量翻倍
+        size_t new_capacity = (_size + 1 > _max_load(_capacity) / 2) ? _capacity * 2 : _capacity;
+        _rehash(new_capacity);
+    }
+    index = _insert_new(_hash(key), Slot(key, V()));
+    return _slots[index].value;
+}
+
+template <typename K, typename V>
+bool MySwissHashMap<K, V>::erase(const K& key) {
+    size_t index = _find_index(key);
+    if (index == _capacity) {
+        return false;
+    }
+
+    _slots[index].~Slot();
+    _size--;
+
+    // 如果所在的组里本来就有空槽，任何探测到这个组的查找都会在这里停下，
+    // 因此可以直接标记为空；否则必须留下墓碑，保证经过这个组的探测链不被截断
+    const int8_t* group = _ctrl + (index / kGroupWidth) * kGroupWidth;
+    if (_match_empty(group) != 0) {
+        _ctrl[index] = kEmpty;
+        _growth_left++;
+    } else {
+        _ctrl[index] = kDeleted;
+    }
+    return true;
+}
+
+template <typename K, typename V>
+void MySwissHashMap<K, V>::clear() {
+    for (size_t i = 0; i < _capacity; ++i) {
+        if (_ctrl[i] >= 0) _slots[i].~Slot();
+    }
+    if (_ctrl) std::memset(_ctrl, kEmpty, _capacity);
+    _size = 0;
+    _growth_left = _max_load(_capacity);
+}
+
+#endif
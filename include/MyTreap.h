@@ -1,7 +1,20 @@
+#include "MySmallStack.h" // 迭代遍历用的栈
+#include "MyTreeRange.h"  // 区间查询
+#include <limits>
 #include <random>
 #include <iostream>
 #include <functional>
 
+// 节点的随机优先级。
+// 每个线程只用 random_device 播种一次，之后都由 mt19937 生成：random_device 往往要读系统的熵源，
+// 每个节点构造一次，建一棵大树时光这一步就占了大半时间。
+// 范围取满 int，优先级几乎不会相同 (相同时堆序不唯一，树的形状会偏离随机 BST 的期望)
+inline int my_treap_priority() {
+    thread_local std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<int> distrib(1, std::numeric_limits<int>::max());
+    return distrib(gen);
+}
+
 template <typename T>
 struct TreapNode {
     T key;
@@ -10,14 +23,7 @@ struct TreapNode {
     TreapNode* left;
     TreapNode* right;
 
-    TreapNode(const T& k) : key(k), size(1),left(nullptr), right(nullptr) {
-        // 优先级必须是随机的！
-        // C++11 之后的标准方法
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> distrib(1, 10000); // 范围可以自定义
-        priority = distrib(gen);
-    }
+    TreapNode(const T& k) : key(k), priority(my_treap_priority()), size(1), left(nullptr), right(nullptr) {}
 };
 
 template <typename T>
@@ -61,19 +67,24 @@ private:
     TreapNode<T>* _leftRotate(TreapNode<T>* x);
     TreapNode<T>* _rightRotate(TreapNode<T>* y);
 
-    // 递归地对以 node 为根的子树进行中序遍历
-    void _inorder(TreapNode<T>* node, const std::function<void(const T&)>& visit) const {
-        if (node == nullptr) {
-            return;
-        }
-        // 1. 递归遍历左子树
-        _inorder(node->left, visit);
-
-        // 2. 访问当前节点
-        visit(node->key);
+    // 用显式的栈做中序遍历。Treap 的期望高度是 O(log n)，64 层的内联缓冲区基本不会溢出到堆上
+    void _inorder(const TreapNode<T>* root, const std::function<void(const T&)>& visit) const {
+        MySmallStack<const TreapNode<T>*, 64> stack;
+        const TreapNode<T>* node = root;
+        while (node != nullptr || !stack.empty()) {
+            // 1. 一路向左，把经过的节点压栈
+            while (node != nullptr) {
+                stack.push(node);
+                node = node->left;
+            }
+            // 2. 访问当前节点
+            node = stack.top();
+            stack.pop();
+            visit(node->key);
 
-        // 3. 递归遍历右子树
-        _inorder(node->right, visit);
+            // 3. 转向右子树
+            node = node->right;
+        }
     }
 
     T* _find_value(TreapNode<T>* node, const T& value) const;
@@ -124,11 +135,36 @@ public:
         _root = nullptr;
     }
 
+    // 用升序的区间 [first, last) 替换整棵树的内容，O(n)。
+    // 节点按 key 的顺序到来，key 的顺序已经对了，只需要满足堆序：这就是建笛卡尔树 (Cartesian tree) 的过程。
+    // 用一个栈维护当前的“右链”，新节点到来时把优先级比它大的节点弹出来挂到它的左边，再把它接到右链末尾。
+    // 每个节点只进出栈一次，没有旋转，也没有递归。相等的相邻元素只保留一个；输入无序时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last);
+
     bool empty() const {return _root == nullptr;}
 
     T* find_value(const T& value) const {
         return _find_value(_root, value);
     }
+
+    // 区间查询 [lo, hi)：只下降到和区间有交集的子树里，期望 O(log n + k)。
+    // visitor 返回 bool 时，返回 false 就提前结束
+    using range_iterator = MyTreeRangeIterator<TreapNode<T>, T, &TreapNode<T>::key>;
+    MyIteratorRange<range_iterator> range(const T& lo, const T& hi) const {
+        return {range_iterator(_root, lo, hi), range_iterator()};
+    }
+    template <typename Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor&& visit) const {
+        for (const T& value : range(lo, hi)) {
+            if (!my_range_visit(visit, value)) return;
+        }
+    }
+
+    // 顺序统计：利用节点上的 size 沿一条路径往下走，期望 O(log n)
+    T* select(size_t k) const;                              // 第 k 小的元素 (k 从 0 开始)，越界返回 nullptr
+    size_t rank(const T& key) const;                        // 严格小于 key 的元素个数
+    size_t count_in_range(const T& lo, const T& hi) const;  // 落在 [lo, hi) 中的元素个数
 };
 
 template <typename T>
@@ -278,4 +314,82 @@ T *MyTreap<T>::_find_value(TreapNode<T> *node, const T &value) const {
     }
 }
 
+template<typename T>
+T *MyTreap<T>::select(size_t k) const {
+    TreapNode<T>* node = _root;
+    while (node != nullptr) {
+        size_t left_size = node->left ? node->left->size : 0;
+        if (k < left_size) {
+            node = node->left;
+        }
+        else if (k == left_size) {
+            return &(node->key);
+        }
+        else {
+            k -= left_size + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+size_t MyTreap<T>::rank(const T &key) const {
+    size_t result = 0;
+    TreapNode<T>* node = _root;
+    while (node != nullptr) {
+        if (node->key < key) {
+            result += 1 + (node->left ? node->left->size : 0);
+            node = node->right;
+        }
+        else {
+            node = node->left;
+        }
+    }
+    return result;
+}
 
+template<typename T>
+size_t MyTreap<T>::count_in_range(const T &lo, const T &hi) const {
+    if (!(lo < hi)) return 0;
+    return rank(hi) - rank(lo);
+}
+
+template<typename T>
+template<typename ForwardIt>
+void MyTreap<T>::build_from_sorted(ForwardIt first, ForwardIt last) {
+    my_count_sorted_unique(first, last); // 只用来检查输入是有序的
+
+    auto finish = [](TreapNode<T>* node) {
+        // 节点离开右链时，它的左右子树都已经定型，可以算 size 了
+        node->size = 1 + (node->left ? node->left->size : 0) + (node->right ? node->right->size : 0);
+    };
+
+    MySmallStack<TreapNode<T>*, 64> spine; // 右链，栈顶是最右下的节点
+    TreapNode<T>* new_root = nullptr;
+    for (ForwardIt it = first; it != last; ++it) {
+        if (!spine.empty() && !(spine.top()->key < *it)) continue; // 跳过重复的元素 (右链末尾就是上一个元素)
+        TreapNode<T>* node = new TreapNode<T>(*it);
+
+        // 1. 右链上优先级更大 (更靠下) 的节点都成为新节点的左子树
+        TreapNode<T>* last_popped = nullptr;
+        while (!spine.empty() && spine.top()->priority > node->priority) {
+            last_popped = spine.top();
+            spine.pop();
+            finish(last_popped);
+        }
+        node->left = last_popped;
+
+        // 2. 新节点接到右链末尾
+        if (spine.empty()) new_root = node;
+        else spine.top()->right = node;
+        spine.push(node);
+    }
+    while (!spine.empty()) {
+        finish(spine.top());
+        spine.pop();
+    }
+
+    _destroy_tree(_root);
+    _root = new_root;
+}
@@ -0,0 +1,129 @@
+#ifndef MYTREERANGE_H
+#define MYTREERANGE_H
+
+#include "MySmallStack.h"
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits>
+
+/*
+ * 搜索树的区间查询 [lo, hi) 和批量建树共用的小工具 (MyBST / MyTreap / MyAVLTree)。
+ *
+ * 区间查询只下降到和 [lo, hi) 有交集的子树里：先沿一条路径找到第一个不小于 lo 的节点 (O(h))，
+ * 再按中序往后走，遇到第一个不小于 hi 的节点就停，总共 O(h + k)，k 是区间里的元素个数。
+ * MyBST 有 parent 指针，区间直接用它自己的中序迭代器表示；另外两棵树用下面带栈的 MyTreeRangeIterator。
+ */
+
+// build_from_sorted 的第一遍：检查 [first, last) 是升序的 (无序时抛出 std::invalid_argument)，
+// 并数出去重之后的元素个数，建树时就知道每棵子树该放几个元素
+template <typename ForwardIt>
+size_t my_count_sorted_unique(ForwardIt first, ForwardIt last) {
+    if (first == last) return 0;
+    size_t count = 1;
+    ForwardIt prev = first;
+    for (ForwardIt it = std::next(first); it != last; prev = it, ++it) {
+        if (*it < *prev) throw std::invalid_argument("build_from_sorted: input is not sorted");
+        if (*prev < *it) count++;
+    }
+    return count;
+}
+
+// 一对迭代器，可以直接用在 range-for 里
+template <typename Iterator>
+class MyIteratorRange {
+public:
+    MyIteratorRange(Iterator first, Iterator last) : _first(first), _last(last) {}
+
+    Iterator begin() const { return _first; }
+    Iterator end() const { return _last; }
+    bool empty() const { return _first == _last; }
+
+private:
+    Iterator _first;
+    Iterator _last;
+};
+
+// 调用区间查询的 visitor：visitor 可以返回 void (访问全部)，也可以返回 bool，返回 false 表示提前结束
+template <typename Visitor, typename Value>
+bool my_range_visit(Visitor& visit, const Value& value) {
+    if constexpr (std::is_same<decltype(visit(value)), bool>::value) {
+        return visit(value);
+    }
+    else {
+        visit(value);
+        return true;
+    }
+}
+
+/*
+ * 没有 parent 指针的树 (MyTreap / MyAVLTree) 用的区间迭代器 (前向)。
+ *
+ * 迭代器里带着一个显式的栈，栈里是“还没访问、且左子树已经访问完或正在访问”的祖先，栈顶就是当前元素；
+ * ++ 时弹出栈顶，再把它右子树的左链压进去。平衡树的高度是 O(log n)，栈放在 MySmallStack 的内联缓冲区里。
+ * 当前元素不小于 hi 时清空栈，于是所有走到区间末尾的迭代器都等于默认构造的 end。
+ * Field 是节点里存元素的成员 (MyTreap 是 key，MyAVLTree 是 data)。
+ */
+template <typename Node, typename T, T Node::*Field, size_t InlineDepth = 64>
+class MyTreeRangeIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    MyTreeRangeIterator() {} // end
+
+    // 指向 root 中第一个不小于 lo 的元素，走到不小于 hi 的元素时结束
+    MyTreeRangeIterator(const Node* root, const T& lo, const T& hi) : _hi(hi) {
+        const Node* node = root;
+        while (node != nullptr) {
+            if (node->*Field < lo) {
+                node = node->right; // 整棵左子树和它自己都在区间外，不用进去
+            }
+            else {
+                _stack.push(node);
+                node = node->left;
+            }
+        }
+        _check_end();
+    }
+
+    reference operator*() const { return _stack.top()->*Field; }
+    pointer operator->() const { return &(_stack.top()->*Field); }
+
+    MyTreeRangeIterator& operator++() {
+        const Node* node = _stack.top()->right;
+        _stack.pop();
+        while (node != nullptr) {
+            _stack.push(node);
+            node = node->left;
+        }
+        _check_end();
+        return *this;
+    }
+
+    MyTreeRangeIterator operator++(int) {
+        MyTreeRangeIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const MyTreeRangeIterator& other) const {
+        if (_stack.empty() || other._stack.empty()) return _stack.empty() && other._stack.empty();
+        return _stack.top() == other._stack.top();
+    }
+    bool operator!=(const MyTreeRangeIterator& other) const { return !(*this == other); }
+
+private:
+    MySmallStack<const Node*, InlineDepth> _stack;
+    std::optional<T> _hi; // 存一份拷贝：调用方传进来的 hi 可能是临时对象
+
+    void _check_end() {
+        if (!_stack.empty() && !(_stack.top()->*Field < *_hi)) _stack.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,420 @@
+#ifndef MYUNROLLEDLIST_H
+#define MYUNROLLEDLIST_H
+
+#include <cstddef>
+#include <new>       // placement new
+#include <stdexcept> // std::out_of_range
+#include <utility>   // std::move
+
+/*
+ * MyUnrolledList: 展开链表 (unrolled linked list)
+ *
+ * MyLinkedList 每个元素一个节点：遍历时每个元素都要跳一次指针、碰一条新的缓存行，
+ * 而且每个元素额外带着 16 字节的 prev / next 指针。
+ * 展开链表让每个节点装一个小数组 (最多 NodeCapacity 个元素，外加一个计数 count)：
+ *   - 遍历时同一节点内的元素在内存中是连续的，一次指针跳转换来一整段顺序访问；
+ *   - prev / next 的开销被 NodeCapacity 个元素均摊。
+ *
+ * 对外接口与 MyLinkedList 保持一致：push / pop / front / back、双向迭代器、erase(iterator)，
+ * 另外提供 insert(iterator, value)。
+ *
+ * 与 MyLinkedList 的区别：元素会在节点内部、以及节点分裂 / 合并时被移动，
+ * 所以 insert / erase 之后，指向 *其他* 元素的迭代器、引用和指针也可能失效 (类似 MyVector)。
+ */
+
+// 默认每个节点大约占 256 字节的元素空间，至少 8 个元素
+template <typename T>
+constexpr size_t my_unrolled_default_capacity() {
+    return 256 / sizeof(T) < 8 ? 8 : 256 / sizeof(T);
+}
+
+template <typename T, size_t NodeCapacity = my_unrolled_default_capacity<T>()>
+class MyUnrolledList {
+    static_assert(NodeCapacity >= 2, "MyUnrolledList needs at least 2 elements per node");
+
+private:
+    struct Node {
+        Node* prev;
+        Node* next;
+        size_t count; // 当前节点中实际存放的元素个数，元素总是紧凑地放在 [0, count)
+        alignas(T) unsigned char storage[NodeCapacity * sizeof(T)]; // 未构造的原始内存
+
+        Node() : prev(nullptr), next(nullptr), count(0) {}
+
+        T* at(size_t i) { return reinterpret_cast<T*>(storage) + i; }
+        const T* at(size_t i) const { return reinterpret_cast<const T*>(storage) + i; }
+    };
+
+    Node* _head;
+    Node* _tail;
+    size_t _size;
+    size_t _node_count;
+
+    Node* _new_node_after(Node* prev);  // 创建一个空节点挂在 prev 之后 (prev 为 nullptr 时挂在头部)
+    void _free_node(Node* node);        // 从链表摘下一个空节点并释放
+    // 在 node 的下标 index 处插入，元素依次后移 (调用方保证 node 没有满)。
+    // value 按值传入：即使它原本引用着本节点中即将被挪动的元素也没关系
+    void _insert_in_node(Node* node, size_t index, T value);
+    // 把 node 的后一半元素搬到一个新节点中，返回新节点
+    Node* _split(Node* node);
+
+public:
+    class const_iterator;
+
+    // 双向迭代器：节点指针 + 节点内下标，end() 为 {nullptr, 0}
+    class iterator {
+    public:
+        iterator(Node* node = nullptr, size_t index = 0) : _node(node), _index(index) {}
+
+        T& operator*() const { return *_node->at(_index); }
+        T* operator->() const { return _node->at(_index); }
+
+        iterator& operator++() {
+            if (++_index == _node->count) {
+                _node = _node->next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        iterator& operator--() {
+            if (_index > 0) {
+                --_index;
+            }
+            else {
+                _node = _node->prev;
+                _index = _node ? _node->count - 1 : 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return _node == other._node && _index == other._index; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+
+        Node* getNode() const { return _node; }
+        size_t getIndex() const { return _index; }
+
+    private:
+        Node* _node;
+        size_t _index;
+    };
+
+    class const_iterator {
+    public:
+        const_iterator(const Node* node = nullptr, size_t index = 0) : _node(node), _index(index) {}
+        const_iterator(const iterator& it) : _node(it.getNode()), _index(it.getIndex()) {}
+
+        const T& operator*() const { return *_node->at(_index); }
+        const T* operator->() const { return _node->at(_index); }
+
+        const_iterator& operator++() {
+            if (++_index == _node->count) {
+                _node = _node->next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        const_iterator& operator--() {
+            if (_index > 0) {
+                --_index;
+            }
+            else {
+                _node = _node->prev;
+                _index = _node ? _node->count - 1 : 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return _node == other._node && _index == other._index; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        const Node* _node;
+        size_t _index;
+    };
+
+    MyUnrolledList();
+    MyUnrolledList(const MyUnrolledList& other);
+    MyUnrolledList& operator=(const MyUnrolledList& other);
+    ~MyUnrolledList();
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    void push_back(const T& value);
+    void push_front(const T& value);
+
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    void pop_front();
+    void pop_back();
+
+    iterator begin() { return iterator(_head, 0); }
+    iterator end() { return iterator(nullptr, 0); }
+    const_iterator begin() const { return const_iterator(_head, 0); }
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // 在 pos 之前插入 value，返回指向新元素的迭代器。节点满了会先一分为二。
+    iterator insert(iterator pos, const T& value);
+
+    // 删除 pos 指向的元素，返回指向下一个元素的迭代器。
+    // 节点变得不到半满时，如果能装下就把后一个节点合并进来，避免出现大量几乎为空的节点。
+    iterator erase(iterator pos);
+
+    void clear();
+
+    // 统计信息：节点个数，以及所有节点占用的字节数 (不含 malloc 自身的开销)
+    size_t node_count() const { return _node_count; }
+    size_t memory_bytes() const { return _node_count * sizeof(Node); }
+    static constexpr size_t node_capacity() { return NodeCapacity; }
+};
+
+// ------------------- 私有辅助函数 -------------------
+
+template <typename T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::Node* MyUnrolledList<T, NodeCapacity>::_new_node_after(Node* prev) {
+    Node* node = new Node();
+    node->prev = prev;
+    node->next = prev ? prev->next : _head;
+    if (node->next) node->next->prev = node;
+    else _tail = node;
+    if (prev) prev->next = node;
+    else _head = node;
+    _node_count++;
+    return node;
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::_free_node(Node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else _head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else _tail = node->prev;
+    delete node;
+    _node_count--;
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::_insert_in_node(Node* node, size_t index, T value) {
+    for (size_t i = node->count; i > index; --i) {
+        ::new (node->at(i)) T(std::move(*node->at(i - 1)));
+        node->at(i - 1)->~T();
+    }
+    ::new (node->at(index)) T(std::move(value));
+    node->count++;
+    _size++;
+}
+
+template <typename T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::Node* MyUnrolledList<T, NodeCapacity>::_split(Node* node) {
+    Node* right = _new_node_after(node);
+    size_t keep = node->count / 2;
+    for (size_t i = keep; i < node->count; ++i) {
+        ::new (right->at(i - keep)) T(std::move(*node->at(i)));
+        node->at(i)->~T();
+    }
+    right->count = node->count - keep;
+    node->count = keep;
+    return right;
+}
+
+// ------------------- 构造 / 析构 -------------------
+
+template <typename T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>::MyUnrolledList()
+    : _head(nullptr), _tail(nullptr), _size(0), _node_count(0) {}
+
+template <typename T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>::MyUnrolledList(const MyUnrolledList& other)
+    : _head(nullptr), _tail(nullptr), _size(0), _node_count(0)
+{
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+        push_back(*it);
+    }
+}
+
+template <typename T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>& MyUnrolledList<T, NodeCapacity>::operator=(const MyUnrolledList& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+        push_back(*it);
+    }
+    return *this;
+}
+
+template <typename T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>::~MyUnrolledList() {
+    clear();
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::clear() {
+    Node* current = _head;
+    while (current != nullptr) {
+        Node* next_node = current->next;
+        for (size_t i = 0; i < current->count; ++i) current->at(i)->~T();
+        delete current;
+        current = next_node;
+    }
+    _head = _tail = nullptr;
+    _size = 0;
+    _node_count = 0;
+}
+
+// ------------------- push / pop / front / back -------------------
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::push_back(const T& value) {
+    if (_tail == nullptr || _tail->count == NodeCapacity) {
+        // value 可能引用着本链表里的元素，但新建节点不会移动已有元素，所以这里是安全的
+        _new_node_after(_tail);
+    }
+    ::new (_tail->at(_tail->count)) T(value);
+    _tail->count++;
+    _size++;
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::push_front(const T& value) {
+    if (_head == nullptr || _head->count == NodeCapacity) {
+        _new_node_after(nullptr);
+    }
+    _insert_in_node(_head, 0, value);
+}
+
+template <typename T, size_t NodeCapacity>
+T& MyUnrolledList<T, NodeCapacity>::front() {
+    if (empty()) {
+        throw std::out_of_range("Accessing front on empty list");
+    }
+    return *_head->at(0);
+}
+
+template <typename T, size_t NodeCapacity>
+const T& MyUnrolledList<T, NodeCapacity>::front() const {
+    if (empty()) {
+        throw std::out_of_range("Accessing front on empty list");
+    }
+    return *_head->at(0);
+}
+
+template <typename T, size_t NodeCapacity>
+T& MyUnrolledList<T, NodeCapacity>::back() {
+    if (empty()) {
+        throw std::out_of_range("Accessing back on empty list");
+    }
+    return *_tail->at(_tail->count - 1);
+}
+
+template <typename T, size_t NodeCapacity>
+const T& MyUnrolledList<T, NodeCapacity>::back() const {
+    if (empty()) {
+        throw std::out_of_range("Accessing back on empty list");
+    }
+    return *_tail->at(_tail->count - 1);
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("Popping front on empty list");
+    }
+    erase(begin());
+}
+
+template <typename T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("Popping back on empty list");
+    }
+    // 尾部删除不需要挪动任何元素
+    _tail->at(_tail->count - 1)->~T();
+    _tail->count--;
+    _size--;
+    if (_tail->count == 0) {
+        _free_node(_tail);
+    }
+}
+
+// ------------------- insert / erase -------------------
+
+template <typename T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::insert(iterator pos, const T& value) {
+    Node* node = pos.getNode();
+    size_t index = pos.getIndex();
+
+    if (node == nullptr) {
+        // 插在 end() 之前就是 push_back
+        push_back(value);
+        return iterator(_tail, _tail->count - 1);
+    }
+
+    if (node->count == NodeCapacity) {
+        // 先把 value 拷贝出来：分裂会移动元素，value 可能正引用着其中之一
+        T copy(value);
+        Node* right = _split(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = right;
+        }
+        _insert_in_node(node, index, std::move(copy));
+        return iterator(node, index);
+    }
+
+    _insert_in_node(node, index, value);
+    return iterator(node, index);
+}
+
+template <typename T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::erase(iterator pos) {
+    Node* node = pos.getNode();
+    size_t index = pos.getIndex();
+    if (node == nullptr) {
+        return end();
+    }
+
+    // 1. 删除元素，后面的元素依次前移一位
+    node->at(index)->~T();
+    for (size_t i = index + 1; i < node->count; ++i) {
+        ::new (node->at(i - 1)) T(std::move(*node->at(i)));
+        node->at(i)->~T();
+    }
+    node->count--;
+    _size--;
+
+    // 2. 节点空了就直接释放
+    if (node->count == 0) {
+        Node* next_node = node->next;
+        _free_node(node);
+        return iterator(next_node, 0);
+    }
+
+    // 3. 不到半满并且能装下后一个节点时，把后一个节点整个并进来
+    Node* next_node = node->next;
+    if (node->count < NodeCapacity / 2 && next_node != nullptr && node->count + next_node->count <= NodeCapacity) {
+        for (size_t i = 0; i < next_node->count; ++i) {
+            ::new (node->at(node->count + i)) T(std::move(*next_node->at(i)));
+            next_node->at(i)->~T();
+        }
+        node->count += next_node->count;
+        next_node->count = 0;
+        _free_node(next_node);
+    }
+
+    // 4. 被删元素原来的位置上现在就是“下一个元素”，除非它正好在节点末尾
+    if (index == node->count) {
+        return iterator(node->next, 0);
+    }
+    return iterator(node, index);
+}
+
+#endif
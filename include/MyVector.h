@@ -3,6 +3,11 @@
 
 #include <iostream>
 #include <cstddef>
+#include <cstring>     // std::memcpy
+#include <new>         // ::operator new / placement new
+#include <stdexcept>
+#include <type_traits>
+#include <utility>     // std::move, std::forward
 
 template <typename T>
 class MyVector {
@@ -49,6 +54,8 @@ public:
     // 它的唯一作用就是禁止编译器使用这个构造函数来进行隐式的类型转换。
     MyVector(const MyVector& other); // 拷贝构造函数
     MyVector& operator=(const MyVector& other); // 拷贝赋值运算符
+    MyVector(MyVector&& other) noexcept; // 移动构造函数：直接“偷走” other 的缓冲区
+    MyVector& operator=(MyVector&& other) noexcept; // 移动赋值运算符
     ~MyVector();
 
     // 容量相关
@@ -56,6 +63,7 @@ public:
     size_t capacity() const { return _capacity; }
     bool empty() const;
     void resize(size_t new_size);
+    void reserve(size_t new_capacity); // 预留容量，避免反复扩容
 
     // 元素访问
     T& operator[](size_t index);
@@ -88,6 +96,9 @@ public:
 
     // 修改器
     void push_back(const T& value);
+    void push_back(T&& value); // 右值版本：移动而不是拷贝
+    template <typename... Args>
+    T& emplace_back(Args&&... args); // 直接在尾部原地构造
     void pop_back();
     void clear();
 
@@ -98,6 +109,23 @@ private:
 
     void _resize(size_t new_capacity);
 
+    // 原始内存管理：只分配/释放内存，不构造/析构对象
+    // 这样 [_size, _capacity) 区间就是“未初始化”的内存，不再需要 T 的默认构造
+    static T* _allocate(size_t n) {
+        return n == 0 ? nullptr : static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    static void _deallocate(T* p) { ::operator delete(p); }
+    static void _destroy_range(T* first, T* last) {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) first->~T();
+        }
+    }
+    // 把 [src, src + n) 的元素“搬家”到未初始化的 dst 中，并析构旧元素
+    // 可平凡拷贝的类型直接 memcpy；其他类型逐个移动构造（移动可能抛异常时退回拷贝）
+    static void _relocate(T* src, size_t n, T* dst);
+    // 扩容时的新容量：翻倍
+    size_t _grow_capacity() const { return _capacity == 0 ? 1 : _capacity * 2; }
+
 };
 
 /*
@@ -113,7 +141,10 @@ MyVector<T>::MyVector() : _data(nullptr), _size(0), _capacity(0) {
 template<typename T>
 MyVector<T>::MyVector(size_t count) : _data(nullptr),_size(count),_capacity(count){
 
-    if (count > 0) _data = new T[count];
+    _data = _allocate(count);
+    for (size_t i = 0; i < count; ++i) {
+        new (_data + i) T();
+    }
 
     //std::cout << "Default constructor with size_t called!" << std::endl;
 }
@@ -129,16 +160,45 @@ MyVector<T>::MyVector(const MyVector& other)
     if (other._capacity > 0) {
         // 1. 为 _data 分配一块新的、属于自己的内存。
         //    大小应该是多少？
-        _data = new T[other.capacity()];
+        _data = _allocate(other.capacity());
 
-        // 2. 将 'other' 对象中的数据逐个拷贝到这块新内存中。
+        // 2. 将 'other' 对象中的数据逐个拷贝构造到这块新内存中。
         //    应该循环多少次？是从 0 到 _size 还是 _capacity？
         for (size_t i = 0; i < other.size(); ++i) {
-            _data[i] = other._data[i];
+            new (_data + i) T(other._data[i]);
         }
     }
 }
 
+template <typename T>
+MyVector<T>::MyVector(MyVector&& other) noexcept
+    : _data(other._data), _size(other._size), _capacity(other._capacity)
+{
+    // 把 other 置为空壳，它析构时不会释放我们接管的内存
+    other._data = nullptr;
+    other._size = 0;
+    other._capacity = 0;
+}
+
+template <typename T>
+MyVector<T>& MyVector<T>::operator=(MyVector&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    _destroy_range(_data, _data + _size);
+    _deallocate(_data);
+
+    _data = other._data;
+    _size = other._size;
+    _capacity = other._capacity;
+
+    other._data = nullptr;
+    other._size = 0;
+    other._capacity = 0;
+    return *this;
+}
+
 template <typename T>
 MyVector<T>& MyVector<T>::operator=(const MyVector& other) {
     //std::cout << "Copy assignment operator called!" << std::endl;
@@ -153,7 +213,8 @@ MyVector<T>& MyVector<T>::operator=(const MyVector& other) {
     // 步骤 2: 释放当前对象已有的内存
     // 因为我们将要从 'other' 拷贝新的数据，所以旧的内存不再需要。
     /* ... 释放 _data 指向的内存 ... */
-    delete[] _data;
+    _destroy_range(_data, _data + _size);
+    _deallocate(_data);
 
 
     // 步骤 3: 进行和拷贝构造函数几乎一样的深拷贝
@@ -163,10 +224,10 @@ MyVector<T>& MyVector<T>::operator=(const MyVector& other) {
 
     if (other._capacity > 0) {
         // 分配新内存
-        _data = new T[_capacity];
+        _data = _allocate(_capacity);
         // 循环拷贝数据
         for (size_t i = 0; i < _size; ++i) {
-            _data[i] = other._data[i];
+            new (_data + i) T(other._data[i]);
         }
     }
 
@@ -179,29 +240,76 @@ MyVector<T>& MyVector<T>::operator=(const MyVector& other) {
 template <typename T>
 MyVector<T>::~MyVector() {
     //std::cout << "Destructor called!" << std::endl;
-    delete[] _data;
+    _destroy_range(_data, _data + _size);
+    _deallocate(_data);
 }
 
 template <typename T>
 void MyVector<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T>
+void MyVector<T>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+T& MyVector<T>::emplace_back(Args&&... args) {
     if (_size == _capacity) {
-        _resize(_capacity == 0 ? 1 : _capacity * 2);
+        // 注意：args 可能引用着本容器中的元素 (例如 vec.push_back(vec[0]))，
+        // 所以必须先在新内存中构造新元素，再搬迁旧元素、释放旧内存
+        size_t new_capacity = _grow_capacity();
+        T* new_data = _allocate(new_capacity);
+        try {
+            new (new_data + _size) T(std::forward<Args>(args)...);
+        } catch (...) {
+            _deallocate(new_data);
+            throw;
+        }
+        _relocate(_data, _size, new_data);
+        _deallocate(_data);
+        _data = new_data;
+        _capacity = new_capacity;
+    } else {
+        new (_data + _size) T(std::forward<Args>(args)...);
     }
-    _data[_size++] = value;
+    return _data[_size++];
+}
+
+template <typename T>
+void MyVector<T>::_relocate(T* src, size_t n, T* dst) {
+    if (n == 0) return;
+    if (std::is_trivially_copyable<T>::value) {
+        // 平凡类型：逐字节搬迁即可，旧内存中的对象无需析构
+        std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        new (dst + i) T(std::move_if_noexcept(src[i]));
+    }
+    _destroy_range(src, src + n);
 }
 
 template <typename T>
 void MyVector<T>::_resize(size_t new_capacity) {
     //std::cout << "Resizing from " << _capacity << " to " << new_capacity << std::endl;
-    T* new_data = new T[new_capacity];
-    for (size_t i = 0; i < _size; i++) {
-        new_data[i] = _data[i];
-    }
-    delete[] _data;
+    // 只分配原始内存，把已有的 _size 个元素移动过去；[_size, new_capacity) 保持未初始化
+    T* new_data = _allocate(new_capacity);
+    _relocate(_data, _size, new_data);
+    _deallocate(_data);
     _data = new_data;
     _capacity = new_capacity;
 }
 
+template <typename T>
+void MyVector<T>::reserve(size_t new_capacity) {
+    if (new_capacity > _capacity) {
+        _resize(new_capacity);
+    }
+}
+
 template<typename T>
 bool MyVector<T>::empty() const {return _size == 0;}
 
@@ -224,11 +332,15 @@ const T &MyVector<T>::operator[](size_t index) const {
 
 template<typename T>
 void MyVector<T>::pop_back() {
-    if (_size > 0) _size--;
+    if (_size > 0) {
+        _size--;
+        _data[_size].~T(); // 元素真正被析构，释放它持有的资源
+    }
 }
 
 template<typename T>
 void MyVector<T>::clear() {
+    _destroy_range(_data, _data + _size);
     _size = 0;
 }
 
@@ -241,11 +353,14 @@ void MyVector<T>::resize(size_t new_size) {
         _resize(std::max(new_size,_capacity * 2));
     }
     if (new_size > _size) {
-        // 2. 如果新大小大于当前大小，需要默认构造新的元素
+        // 2. 如果新大小大于当前大小，需要在未初始化的内存上默认构造新的元素
         //    T() 会调用 T 类型的默认构造函数
         for (size_t i = _size; i < new_size; i++) {
-            _data[i] = T();
+            new (_data + i) T();
         }
+    } else {
+        // 3. 缩小时，多出来的元素需要析构
+        _destroy_range(_data + new_size, _data + _size);
     }
     _size = new_size;
 }
@@ -22,6 +22,15 @@
 #include "mysetpro/test_mysetpro.h"
 #include "mymappro/test_mymappro.h"
 #include "mydisjointset/test_mydisjointset.h"
+#include "myflathashmap/test_myflathashmap.h"
+#include "myswisshashmap/test_myswisshashmap.h"
+#include "myconcurrenthashmap/test_myconcurrenthashmap.h"
+#include "myunrolledlist/test_myunrolledlist.h"
+#include "myintrusivelist/test_myintrusivelist.h"
+#include "mylrucache/test_mylrucache.h"
+#include "myspscqueue/test_myspscqueue.h"
+#include "mympmcqueue/test_mympmcqueue.h"
+#include "myavltree/test_myavltree.h"
 
 
 // 帮助函数: 将所有测试按顺序执行。
@@ -46,6 +55,15 @@ void run_all_tests_sequentially() {
     TestMySetPro::run_all_tests();
     TestMyMapPro::run_all_tests();
     TestMyDisjointSet::run_all_tests();
+    TestMyFlatHashMap::run_all_tests();
+    TestMySwissHashMap::run_all_tests();
+    TestMyConcurrentHashMap::run_all_tests();
+    TestMyUnrolledList::run_all_tests();
+    TestMyIntrusiveList::run_all_tests();
+    TestMyLRUCache::run_all_tests();
+    TestMySPSCQueue::run_all_tests();
+    TestMyMPMCQueue::run_all_tests();
+    TestMyAVLTree::run_all_tests();
 
     cout << "\n--- All tests completed ---" << endl;
 }
@@ -78,6 +96,15 @@ void runInteractiveMode() {
         cout << " 14. MySetPro Tests\n";
         cout << " 15. MyMapPro Tests\n";
         cout << " 16. MyDisjointSet Tests\n";
+        cout << " 17. MyFlatHashMap Tests\n";
+        cout << " 18. MySwissHashMap Tests\n";
+        cout << " 19. MyConcurrentHashMap Tests\n";
+        cout << " 20. MyUnrolledList Tests\n";
+        cout << " 21. MyIntrusiveList Tests\n";
+        cout << " 22. MyLRUCache Tests\n";
+        cout << " 23. MySPSCQueue Tests\n";
+        cout << " 24. MyMPMCQueue Tests\n";
+        cout << " 25. MyAVLTree Tests\n";
         cout << "------------------------------------------\n";
         cout << "  0. Run ALL tests\n";
         cout << " -1. Exit\n";
@@ -111,6 +138,15 @@ void runInteractiveMode() {
             case 14: TestMySetPro::run_all_tests(); TestRunner::print_summary(); break;
             case 15: TestMyMapPro::run_all_tests(); TestRunner::print_summary(); break;
             case 16: TestMyDisjointSet::run_all_tests(); TestRunner::print_summary(); break;
+            case 17: TestMyFlatHashMap::run_all_tests(); TestRunner::print_summary(); break;
+            case 18: TestMySwissHashMap::run_all_tests(); TestRunner::print_summary(); break;
+            case 19: TestMyConcurrentHashMap::run_all_tests(); TestRunner::print_summary(); break;
+            case 20: TestMyUnrolledList::run_all_tests(); TestRunner::print_summary(); break;
+            case 21: TestMyIntrusiveList::run_all_tests(); TestRunner::print_summary(); break;
+            case 22: TestMyLRUCache::run_all_tests(); TestRunner::print_summary(); break;
+            case 23: TestMySPSCQueue::run_all_tests(); TestRunner::print_summary(); break;
+            case 24: TestMyMPMCQueue::run_all_tests(); TestRunner::print_summary(); break;
+            case 25: TestMyAVLTree::run_all_tests(); TestRunner::print_summary(); break;
             case 0: run_all_tests_sequentially(); break; // 这个函数自己会处理摘要
             case -1: cout << "Exiting program.\n"; return;
             default: cout << "\n[Error] Invalid choice. Please try again.\n"; break;
@@ -142,6 +178,15 @@ void runCommandMode(int argc, char* argv[]) {
         cout << "test_setpro;MySetPro Tests" << endl;
         cout << "test_mappro;MyMapPro Tests" << endl;
         cout << "test_disjointset;MyDisjointSet Tests" << endl;
+        cout << "test_flathashmap;MyFlatHashMap Tests" << endl;
+        cout << "test_swisshashmap;MySwissHashMap Tests" << endl;
+        cout << "test_concurrenthashmap;MyConcurrentHashMap Tests" << endl;
+        cout << "test_unrolledlist;MyUnrolledList Tests" << endl;
+        cout << "test_intrusivelist;MyIntrusiveList Tests" << endl;
+        cout << "test_lrucache;MyLRUCache Tests" << endl;
+        cout << "test_spscqueue;MySPSCQueue Tests" << endl;
+        cout << "test_mpmcqueue;MyMPMCQueue Tests" << endl;
+        cout << "test_avltree;MyAVLTree Tests" << endl;
         cout << "test_all;Run ALL Tests" << endl;
         return;
     }
@@ -167,6 +212,15 @@ void runCommandMode(int argc, char* argv[]) {
         else if (group_name == "test_setpro") test_cases = &TestMySetPro::get_test_cases();
         else if (group_name == "test_mappro") test_cases = &TestMyMapPro::get_test_cases();
         else if (group_name == "test_disjointset") test_cases = &TestMyDisjointSet::get_test_cases();
+        else if (group_name == "test_flathashmap") test_cases = &TestMyFlatHashMap::get_test_cases();
+        else if (group_name == "test_swisshashmap") test_cases = &TestMySwissHashMap::get_test_cases();
+        else if (group_name == "test_concurrenthashmap") test_cases = &TestMyConcurrentHashMap::get_test_cases();
+        else if (group_name == "test_unrolledlist") test_cases = &TestMyUnrolledList::get_test_cases();
+        else if (group_name == "test_intrusivelist") test_cases = &TestMyIntrusiveList::get_test_cases();
+        else if (group_name == "test_lrucache") test_cases = &TestMyLRUCache::get_test_cases();
+        else if (group_name == "test_spscqueue") test_cases = &TestMySPSCQueue::get_test_cases();
+        else if (group_name == "test_mpmcqueue") test_cases = &TestMyMPMCQueue::get_test_cases();
+        else if (group_name == "test_avltree") test_cases = &TestMyAVLTree::get_test_cases();
 
         if (test_cases) {
             for (const auto& test_case : *test_cases) {
@@ -200,6 +254,15 @@ void runCommandMode(int argc, char* argv[]) {
         else if (group_name == "test_setpro") test_cases = &TestMySetPro::get_test_cases();
         else if (group_name == "test_mappro") test_cases = &TestMyMapPro::get_test_cases();
         else if (group_name == "test_disjointset") test_cases = &TestMyDisjointSet::get_test_cases();
+        else if (group_name == "test_flathashmap") test_cases = &TestMyFlatHashMap::get_test_cases();
+        else if (group_name == "test_swisshashmap") test_cases = &TestMySwissHashMap::get_test_cases();
+        else if (group_name == "test_concurrenthashmap") test_cases = &TestMyConcurrentHashMap::get_test_cases();
+        else if (group_name == "test_unrolledlist") test_cases = &TestMyUnrolledList::get_test_cases();
+        else if (group_name == "test_intrusivelist") test_cases = &TestMyIntrusiveList::get_test_cases();
+        else if (group_name == "test_lrucache") test_cases = &TestMyLRUCache::get_test_cases();
+        else if (group_name == "test_spscqueue") test_cases = &TestMySPSCQueue::get_test_cases();
+        else if (group_name == "test_mpmcqueue") test_cases = &TestMyMPMCQueue::get_test_cases();
+        else if (group_name == "test_avltree") test_cases = &TestMyAVLTree::get_test_cases();
 
         if (test_cases) {
             bool found = false;
@@ -239,6 +302,15 @@ void runCommandMode(int argc, char* argv[]) {
     else if (command == "test_setpro") TestMySetPro::run_all_tests();
     else if (command == "test_mappro") TestMyMapPro::run_all_tests();
     else if (command == "test_disjointset") TestMyDisjointSet::run_all_tests();
+    else if (command == "test_flathashmap") TestMyFlatHashMap::run_all_tests();
+    else if (command == "test_swisshashmap") TestMySwissHashMap::run_all_tests();
+    else if (command == "test_concurrenthashmap") TestMyConcurrentHashMap::run_all_tests();
+    else if (command == "test_unrolledlist") TestMyUnrolledList::run_all_tests();
+    else if (command == "test_intrusivelist") TestMyIntrusiveList::run_all_tests();
+    else if (command == "test_lrucache") TestMyLRUCache::run_all_tests();
+    else if (command == "test_spscqueue") TestMySPSCQueue::run_all_tests();
+    else if (command == "test_mpmcqueue") TestMyMPMCQueue::run_all_tests();
+    else if (command == "test_avltree") TestMyAVLTree::run_all_tests();
     else if (command == "test_all") {
         run_all_tests_sequentially();
         return; // all tests 模式自己管理摘要，所以提前退出
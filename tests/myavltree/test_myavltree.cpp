@@ -0,0 +1,345 @@
+#include "test_myavltree.h"
+
+#include "common/test_common.h"
+#include "MyAVLTree.h"
+#include "MyBST.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace TestMyAVLTree {
+
+    static volatile long long g_sink = 0;
+
+    // AVL 树高的理论上界：1.44 * log2(n + 2)
+    static bool within_avl_bound(int height, size_t n) {
+        return height <= 1.4405 * std::log2(static_cast<double>(n) + 2.0);
+    }
+
+    static std::vector<int> collect_inorder(const MyAVLTree<int>& tree) {
+        std::vector<int> result;
+        tree.inorder([&](const int& v) { result.push_back(v); });
+        return result;
+    }
+
+    void test_insert_and_find() {
+        MyAVLTree<int> tree;
+        assert(tree.empty() && tree.size() == 0 && tree.height() == 0);
+        for (int v : {50, 30, 70, 20, 40, 60, 80}) tree.insert(v);
+        assert(tree.size() == 7);
+        assert(tree.find(40) && tree.find(80) && !tree.find(45));
+
+        tree.insert(40); // 重复插入什么都不做
+        assert(tree.size() == 7);
+        assert(tree.is_valid());
+
+        int* found = tree.find_value(60);
+        assert(found != nullptr && *found == 60);
+        assert(tree.find_value(65) == nullptr);
+    }
+
+    void test_sorted_insert_stays_balanced() {
+        // 1..7 顺序插入，经过旋转后是一棵满二叉树
+        MyAVLTree<int> tree;
+        for (int i = 1; i <= 7; ++i) tree.insert(i);
+        std::vector<int> pre;
+        tree.preorder([&](const int& v) { pre.push_back(v); });
+        assert((pre == std::vector<int>{4, 2, 1, 3, 6, 5, 7}));
+        std::vector<int> post;
+        tree.postorder([&](const int& v) { post.push_back(v); });
+        assert((post == std::vector<int>{1, 3, 2, 5, 7, 6, 4}));
+        assert(tree.height() == 3);
+
+        // 升序、降序各 10 万个键：MyBST 在这里会退化成高度 10 万的链表
+        MyAVLTree<int> ascending, descending;
+        const int N = 100000;
+        for (int i = 0; i < N; ++i) {
+            ascending.insert(i);
+            descending.insert(N - i);
+        }
+        assert(ascending.size() == N && descending.size() == N);
+        assert(within_avl_bound(ascending.height(), N));
+        assert(within_avl_bound(descending.height(), N));
+        assert(ascending.is_valid() && descending.is_valid());
+    }
+
+    void test_remove() {
+        MyAVLTree<int> tree;
+        for (int v : {50, 30, 70, 20, 40, 60, 80, 35, 45, 65}) tree.insert(v);
+
+        tree.remove(20);  // 叶子
+        tree.remove(60);  // 只有右孩子
+        tree.remove(30);  // 两个孩子
+        tree.remove(50);  // 根
+        tree.remove(999); // 不存在
+        assert(tree.size() == 6);
+        assert(tree.is_valid());
+        assert((collect_inorder(tree) == std::vector<int>{35, 40, 45, 65, 70, 80}));
+
+        // 从一侧删空，强迫另一侧旋转
+        MyAVLTree<int> lopsided;
+        for (int i = 1; i <= 1000; ++i) lopsided.insert(i);
+        for (int i = 1; i <= 900; ++i) {
+            lopsided.remove(i);
+            assert(lopsided.is_valid());
+        }
+        assert(lopsided.size() == 100 && within_avl_bound(lopsided.height(), 100));
+
+        for (int i = 901; i <= 1000; ++i) lopsided.remove(i);
+        assert(lopsided.empty() && lopsided.height() == 0);
+    }
+
+    void test_bounds() {
+        MyAVLTree<int> tree;
+        for (int v = 10; v <= 100; v += 10) tree.insert(v);
+        assert(tree.lower_bound(40)->data == 40);
+        assert(tree.lower_bound(45)->data == 50);
+        assert(tree.lower_bound(1)->data == 10);
+        assert(tree.lower_bound(101) == nullptr);
+        assert(tree.upper_bound(40)->data == 50);
+        assert(tree.upper_bound(5)->data == 10);
+        assert(tree.upper_bound(100) == nullptr);
+    }
+
+    void test_copy_and_move() {
+        MyAVLTree<std::string> original;
+        for (const char* s : {"pear", "apple", "fig", "kiwi", "banana"}) original.insert(s);
+
+        MyAVLTree<std::string> copy(original);
+        copy.remove("apple");
+        assert(original.size() == 5 && original.find("apple"));
+        assert(copy.size() == 4 && !copy.find("apple") && copy.is_valid());
+
+        MyAVLTree<std::string> assigned;
+        assigned.insert("temp");
+        assigned = original;
+        assigned = assigned; // 自赋值
+        assert(assigned.size() == 5 && !assigned.find("temp") && assigned.is_valid());
+
+        MyAVLTree<std::string> moved(std::move(copy));
+        assert(moved.size() == 4 && copy.empty());
+        moved = std::move(assigned);
+        assert(moved.size() == 5 && assigned.empty());
+    }
+
+    void test_random_against_std_set() {
+        std::mt19937 rng(2024);
+        std::uniform_int_distribution<int> key(0, 5000);
+        MyAVLTree<int> tree;
+        std::set<int> reference;
+        for (int step = 0; step < 50000; ++step) {
+            int k = key(rng);
+            if (rng() % 3 == 0) {
+                tree.remove(k);
+                reference.erase(k);
+            }
+            else {
+                tree.insert(k);
+                reference.insert(k);
+            }
+            assert(tree.size() == reference.size());
+            assert(tree.find(k) == (reference.count(k) == 1));
+            if (step % 5000 == 0) assert(tree.is_valid());
+        }
+        assert(tree.is_valid());
+        assert(collect_inorder(tree) == std::vector<int>(reference.begin(), reference.end()));
+    }
+
+    void test_order_statistics() {
+        MyAVLTree<int> tree;
+        for (int i = 0; i < 1000; ++i) tree.insert(i * 2); // 0, 2, 4, ..., 1998
+        for (int i = 0; i < 1000; i += 3) tree.remove(i * 2);
+        std::vector<int> sorted = collect_inorder(tree);
+
+        for (size_t k = 0; k < sorted.size(); ++k) assert(*tree.select(k) == sorted[k]);
+        assert(tree.select(sorted.size()) == nullptr);
+        for (int x = -1; x <= 2000; ++x) {
+            size_t expected = std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin();
+            assert(tree.rank(x) == expected);
+        }
+        assert(tree.count_in_range(100, 200) ==
+               static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), 200) -
+                                   std::lower_bound(sorted.begin(), sorted.end(), 100)));
+        assert(tree.count_in_range(200, 100) == 0);
+    }
+
+    void test_range_queries() {
+        MyAVLTree<int> tree;
+        std::mt19937 rng(23);
+        std::set<int> reference;
+        for (int i = 0; i < 3000; ++i) {
+            int k = static_cast<int>(rng() % 10000);
+            tree.insert(k);
+            reference.insert(k);
+        }
+
+        for (int q = 0; q < 300; ++q) {
+            int lo = static_cast<int>(rng() % 10200) - 100;
+            int hi = lo + static_cast<int>(rng() % 400) - 50; // 偶尔 hi <= lo，应该是空区间
+            std::vector<int> expected;
+            for (auto it = reference.lower_bound(lo); it != reference.end() && *it < hi; ++it) expected.push_back(*it);
+
+            std::vector<int> via_range;
+            for (int v : tree.range(lo, hi)) via_range.push_back(v);
+            assert(via_range == expected);
+
+            std::vector<int> via_visitor;
+            tree.for_each_in_range(lo, hi, [&](const int& v) { via_visitor.push_back(v); });
+            assert(via_visitor == expected);
+        }
+
+        // visitor 返回 false 时提前结束：只取区间里的前 5 个
+        std::vector<int> first_five;
+        tree.for_each_in_range(0, 10000, [&](const int& v) {
+            first_five.push_back(v);
+            return first_five.size() < 5;
+        });
+        assert(first_five == std::vector<int>(reference.begin(), std::next(reference.begin(), 5)));
+
+        // range 可以配合标准算法
+        auto window = tree.range(2000, 3000);
+        assert(static_cast<size_t>(std::distance(window.begin(), window.end())) == tree.count_in_range(2000, 3000));
+        assert(std::is_sorted(window.begin(), window.end()));
+
+        MyAVLTree<int> empty;
+        assert(empty.range(0, 100).empty());
+        int visited = 0;
+        empty.for_each_in_range(0, 100, [&](const int&) { visited++; });
+        assert(visited == 0);
+    }
+
+    void test_build_from_sorted() {
+        // 各种大小都要满足 AVL 的平衡条件，而且树高是最小的
+        for (int n = 0; n <= 300; ++n) {
+            std::vector<int> keys(n);
+            for (int i = 0; i < n; ++i) keys[i] = i * 2;
+            MyAVLTree<int> tree;
+            tree.insert(-5);
+            tree.build_from_sorted(keys.begin(), keys.end());
+            assert(tree.size() == static_cast<size_t>(n) && tree.is_valid());
+            int minimal_height = 0;
+            while ((1 << minimal_height) <= n) minimal_height++; // floor(log2 n) + 1
+            assert(tree.height() == minimal_height);
+        }
+
+        std::vector<std::string> words = {"apple", "apple", "banana", "cherry", "cherry"};
+        MyAVLTree<std::string> tree;
+        tree.build_from_sorted(words.begin(), words.end());
+        assert(tree.size() == 3 && tree.is_valid());
+        tree.insert("date");
+        tree.remove("apple");
+        assert(tree.size() == 3 && tree.is_valid());
+
+        std::vector<std::string> unsorted = {"b", "a"};
+        bool thrown = false;
+        try {
+            tree.build_from_sorted(unsorted.begin(), unsorted.end());
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && tree.size() == 3);
+    }
+
+    void test_balance_benchmark() {
+        // 需求里是 1000 万个键；默认构建没开优化，这里缩小到 100 万，规律是一样的
+        const int N = 1000000;
+        using Clock = std::chrono::steady_clock;
+        auto seconds = [](Clock::time_point t0) {
+            return std::chrono::duration<double>(Clock::now() - t0).count();
+        };
+
+        std::vector<int> sorted(N);
+        for (int i = 0; i < N; ++i) sorted[i] = i;
+        std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+        std::vector<int> shuffled(sorted);
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+
+        auto run = [&](const char* label, auto& tree, const std::vector<int>& keys) {
+            auto t0 = Clock::now();
+            for (int k : keys) tree.insert(k);
+            double insert_s = seconds(t0);
+
+            t0 = Clock::now();
+            long long hits = 0;
+            for (int k : shuffled) hits += tree.find(k);
+            g_sink = hits;
+            double find_s = seconds(t0);
+            assert(tree.size() == keys.size());
+
+            std::cout << label << ": n = " << keys.size() << ", height " << tree.height()
+                      << ", insert " << static_cast<long long>(keys.size() / insert_s) << " ops/s"
+                      << ", find " << static_cast<long long>(shuffled.size() / find_s) << " ops/s" << std::endl;
+            return tree.height();
+        };
+
+        {
+            MyAVLTree<int> tree;
+            int height = run("MyAVLTree sorted  ", tree, sorted);
+            assert(within_avl_bound(height, N));
+            (void)height;
+        }
+        {
+            MyAVLTree<int> tree;
+            int height = run("MyAVLTree reversed", tree, reversed);
+            assert(within_avl_bound(height, N));
+            (void)height;
+        }
+        {
+            MyAVLTree<int> tree;
+            int height = run("MyAVLTree random  ", tree, shuffled);
+            assert(within_avl_bound(height, N));
+            (void)height;
+        }
+        {
+            MyBST<int> tree;
+            run("MyBST     random  ", tree, shuffled);
+        }
+
+        // 有序输入下 MyBST 是 O(n^2) 的，而且递归 _insert 的深度等于树高，只能用很小的 n 演示
+        const int small = 5000;
+        std::vector<int> small_sorted(sorted.begin(), sorted.begin() + small);
+        auto t0 = Clock::now();
+        MyBST<int> degenerate;
+        for (int k : small_sorted) degenerate.insert(k);
+        double bst_s = seconds(t0);
+        assert(degenerate.height() == small);
+        std::cout << "MyBST     sorted  : n = " << small << ", height " << degenerate.height()
+                  << ", insert " << static_cast<long long>(small / bst_s) << " ops/s" << std::endl;
+    }
+
+    static const std::vector<TestCase> avl_test_cases = {
+        {"Insert and Find", test_insert_and_find},
+        {"Sorted Insert Stays Balanced", test_sorted_insert_stays_balanced},
+        {"Remove", test_remove},
+        {"Lower and Upper Bound", test_bounds},
+        {"Copy and Move", test_copy_and_move},
+        {"Random Against std::set", test_random_against_std_set},
+        {"Order Statistics", test_order_statistics},
+        {"Range Queries", test_range_queries},
+        {"Build From Sorted", test_build_from_sorted},
+        {"Balance Benchmark", test_balance_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return avl_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyAVLTree Tests");
+        for (const auto& test_case : avl_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyAVLTree Tests Complete");
+    }
+
+} // namespace TestMyAVLTree
@@ -0,0 +1,23 @@
+#ifndef TEST_MYAVLTREE_H
+#define TEST_MYAVLTREE_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyAVLTree {
+    void test_insert_and_find();
+    void test_sorted_insert_stays_balanced();
+    void test_remove();
+    void test_bounds();
+    void test_copy_and_move();
+    void test_random_against_std_set();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_build_from_sorted();
+    void test_balance_benchmark();
+
+    const std::vector<TestCase>& get_test_cases();
+    void run_all_tests();
+}
+
+#endif
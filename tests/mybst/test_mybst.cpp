@@ -1,7 +1,18 @@
 #include "mybst/test_mybst.h"
 #include "common/test_common.h"
 #include "MyBST.h" // 确保包含了你的头文件
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
 
 namespace TestMyBST {
 
@@ -75,6 +86,33 @@ namespace TestMyBST {
         assert(postorder_result == std::vector<int>({20, 40, 30, 60, 80, 70, 50}));
     }
 
+    void test_deep_tree_traversals() {
+        // 按升序插入会退化成一条向右的链，树高远超遍历栈的内联容量，遍历栈要溢出到堆上
+        const int N = 3000;
+        MyBST<int> bst;
+        for (int i = 0; i < N; ++i) bst.insert(i);
+
+        std::vector<int> inorder_result, preorder_result, postorder_result;
+        bst.inorder([&](const int& value) { inorder_result.push_back(value); });
+        bst.preorder([&](const int& value) { preorder_result.push_back(value); });
+        bst.postorder([&](const int& value) { postorder_result.push_back(value); });
+
+        std::vector<int> expected(N);
+        for (int i = 0; i < N; ++i) expected[i] = i;
+        assert(inorder_result == expected);
+        assert(preorder_result == expected); // 只有右孩子：根 -> 右
+        std::vector<int> reversed(expected.rbegin(), expected.rend());
+        assert(postorder_result == reversed);
+
+        // 空树
+        MyBST<int> empty;
+        int visited = 0;
+        empty.inorder([&](const int&) { visited++; });
+        empty.preorder([&](const int&) { visited++; });
+        empty.postorder([&](const int&) { visited++; });
+        assert(visited == 0);
+    }
+
       void test_lower_bound() {
         MyBST<int> bst;
         // 使用一个确定的数据集: 20, 30, 40, 50, 60, 70, 80
@@ -320,6 +358,270 @@ void test_remove() {
         }
     }
 
+    static volatile long long g_sink = 0;
+
+    void test_iterators() {
+        MyBST<int> bst;
+        for (int v : {50, 30, 70, 20, 40, 60, 80, 35, 65}) bst.insert(v);
+
+        // range-for 按中序输出
+        std::vector<int> forward;
+        for (int v : bst) forward.push_back(v);
+        assert(forward == std::vector<int>({20, 30, 35, 40, 50, 60, 65, 70, 80}));
+
+        // 从 end() 往回走
+        std::vector<int> backward;
+        for (auto it = bst.end(); it != bst.begin();) backward.push_back(*--it);
+        assert(backward == std::vector<int>(forward.rbegin(), forward.rend()));
+
+        // 标准算法
+        assert(std::distance(bst.begin(), bst.end()) == 9);
+        assert(*std::prev(bst.end()) == 80);
+        assert(*std::next(bst.begin(), 3) == 40);
+        assert(std::accumulate(bst.begin(), bst.end(), 0) == 450);
+        assert(std::find(bst.begin(), bst.end(), 65) == bst.find_iter(65));
+        assert(bst.find_iter(99) == bst.end());
+        assert(std::is_sorted(bst.begin(), bst.end()));
+        std::vector<int> reversed(forward.size());
+        std::reverse_copy(bst.begin(), bst.end(), reversed.begin());
+        assert(reversed == backward);
+
+        // 删除后 parent 指针仍然正确：两个孩子的根、单孩子、叶子
+        bst.remove(50);
+        bst.remove(60);
+        bst.remove(20);
+        std::vector<int> after;
+        for (auto it = bst.cbegin(); it != bst.cend(); it++) after.push_back(*it);
+        assert(after == std::vector<int>({30, 35, 40, 65, 70, 80}));
+        std::vector<int> after_backward;
+        for (auto it = bst.end(); it != bst.begin();) after_backward.push_back(*--it);
+        assert(after_backward == std::vector<int>(after.rbegin(), after.rend()));
+
+        // 拷贝出来的树 parent 指针也要正确
+        MyBST<int> copy = bst;
+        assert(std::equal(copy.begin(), copy.end(), after.begin(), after.end()));
+        assert(*--copy.end() == 80);
+
+        MyBST<int> empty;
+        assert(empty.begin() == empty.end());
+    }
+
+    void test_deep_tree_operations() {
+        // 升序 / 降序插入得到深度等于节点数的链，查找、删除、拷贝、析构都不能递归。
+        // 建链本身是 O(n^2) 的，n 只取 1 万，检查的是迭代实现在链上的正确性
+        const int N = 10000;
+        MyBST<int> ascending;
+        MyBST<int> descending;
+        for (int i = 0; i < N; ++i) {
+            ascending.insert(i);
+            descending.insert(N - 1 - i);
+        }
+        assert(ascending.size() == N && ascending.height() == N);
+        assert(descending.size() == N && descending.height() == N);
+        assert(ascending.find(N - 1) && descending.find(0) && !ascending.find(N));
+        assert(ascending.lower_bound(N - 1)->data == N - 1);
+        assert(descending.upper_bound(-1)->data == 0);
+        assert(*std::prev(ascending.end()) == N - 1);
+
+        MyBST<int> copy = ascending;
+        assert(copy.size() == N && copy.height() == N);
+
+        // 从深的一端删：每次都要走到链底
+        for (int i = N - 1; i >= N / 2; --i) ascending.remove(i);
+        assert(ascending.size() == N / 2 && !ascending.find(N / 2) && ascending.find(N / 2 - 1));
+        int expected = 0;
+        for (int v : ascending) assert(v == expected++);
+        assert(expected == N / 2);
+
+        // 随机删插，与 std::set 对照 size 和中序
+        std::mt19937 rng(11);
+        std::set<int> reference(copy.begin(), copy.end());
+        for (int step = 0; step < 2000; ++step) {
+            int k = static_cast<int>(rng() % (N + 100));
+            if (step % 2) {
+                copy.remove(k);
+                reference.erase(k);
+            }
+            else {
+                copy.insert(k);
+                reference.insert(k);
+            }
+        }
+        assert(copy.size() == reference.size());
+        assert(std::equal(copy.begin(), copy.end(), reference.begin(), reference.end()));
+    }
+
+    void test_traversal_benchmark() {
+        const int N = 1000000;
+        std::vector<int> keys(N);
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+        MyBST<int> bst;
+        for (int k : keys) bst.insert(k);
+
+        const int ROUNDS = 5;
+        const long long expected = static_cast<long long>(N) * (N - 1) / 2;
+        auto run = [&](const char* label, auto walk) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < ROUNDS; ++r) {
+                long long sum = walk();
+                assert(sum == expected);
+                g_sink = sum;
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            std::cout << label << ": " << std::chrono::duration<double, std::milli>(t1 - t0).count() / ROUNDS
+                      << " ms per full walk" << std::endl;
+        };
+        run("inorder(std::function)", [&] {
+            long long sum = 0;
+            bst.inorder([&](const int& v) { sum += v; });
+            return sum;
+        });
+        run("visit_inorder(lambda) ", [&] {
+            long long sum = 0;
+            bst.visit_inorder([&](const int& v) { sum += v; });
+            return sum;
+        });
+        run("range-for (iterators) ", [&] {
+            long long sum = 0;
+            for (int v : bst) sum += v;
+            return sum;
+        });
+    }
+
+    void test_order_statistics() {
+        MyBST<int> bst;
+        std::mt19937 rng(3);
+        std::set<int> reference;
+        for (int i = 0; i < 2000; ++i) {
+            int k = static_cast<int>(rng() % 10000);
+            bst.insert(k);
+            reference.insert(k);
+        }
+        for (int i = 0; i < 500; ++i) {
+            int k = static_cast<int>(rng() % 10000);
+            bst.remove(k);
+            reference.erase(k);
+        }
+        std::vector<int> sorted(reference.begin(), reference.end());
+
+        // select(k) 就是排好序之后的第 k 个
+        for (size_t k = 0; k < sorted.size(); ++k) assert(*bst.select(k) == sorted[k]);
+        assert(bst.select(sorted.size()) == nullptr);
+
+        // rank(x) 等于 x 在有序序列中的 lower_bound 下标，存在与不存在的键都要对
+        for (int x = -5; x <= 10005; x += 7) {
+            size_t expected = std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin();
+            assert(bst.rank(x) == expected);
+        }
+        assert(bst.rank(sorted.front()) == 0 && bst.rank(sorted.back() + 1) == sorted.size());
+
+        // count_in_range 是半开区间 [lo, hi)
+        for (int i = 0; i < 200; ++i) {
+            int lo = static_cast<int>(rng() % 10000);
+            int hi = lo + static_cast<int>(rng() % 3000);
+            size_t expected = std::lower_bound(sorted.begin(), sorted.end(), hi) -
+                              std::lower_bound(sorted.begin(), sorted.end(), lo);
+            assert(bst.count_in_range(lo, hi) == expected);
+        }
+        assert(bst.count_in_range(500, 500) == 0 && bst.count_in_range(900, 100) == 0);
+
+        MyBST<int> empty;
+        assert(empty.select(0) == nullptr && empty.rank(42) == 0 && empty.count_in_range(0, 100) == 0);
+    }
+
+    void test_range_queries() {
+        MyBST<int> tree;
+        std::mt19937 rng(17);
+        std::set<int> reference;
+        for (int i = 0; i < 3000; ++i) {
+            int k = static_cast<int>(rng() % 10000);
+            tree.insert(k);
+            reference.insert(k);
+        }
+
+        for (int q = 0; q < 300; ++q) {
+            int lo = static_cast<int>(rng() % 10200) - 100;
+            int hi = lo + static_cast<int>(rng() % 400) - 50; // 偶尔 hi <= lo，应该是空区间
+            std::vector<int> expected;
+            for (auto it = reference.lower_bound(lo); it != reference.end() && *it < hi; ++it) expected.push_back(*it);
+
+            std::vector<int> via_range;
+            for (int v : tree.range(lo, hi)) via_range.push_back(v);
+            assert(via_range == expected);
+
+            std::vector<int> via_visitor;
+            tree.for_each_in_range(lo, hi, [&](const int& v) { via_visitor.push_back(v); });
+            assert(via_visitor == expected);
+        }
+
+        // visitor 返回 false 时提前结束：只取区间里的前 5 个
+        std::vector<int> first_five;
+        tree.for_each_in_range(0, 10000, [&](const int& v) {
+            first_five.push_back(v);
+            return first_five.size() < 5;
+        });
+        assert(first_five == std::vector<int>(reference.begin(), std::next(reference.begin(), 5)));
+
+        // range 可以配合标准算法
+        auto window = tree.range(2000, 3000);
+        assert(static_cast<size_t>(std::distance(window.begin(), window.end())) == tree.count_in_range(2000, 3000));
+        assert(std::is_sorted(window.begin(), window.end()));
+
+        MyBST<int> empty;
+        assert(empty.range(0, 100).empty());
+        int visited = 0;
+        empty.for_each_in_range(0, 100, [&](const int&) { visited++; });
+        assert(visited == 0);
+    }
+
+    void test_build_from_sorted() {
+        std::vector<int> keys(1000);
+        std::iota(keys.begin(), keys.end(), 0);
+
+        MyBST<int> bst;
+        bst.insert(-1); // 原来的内容会被替换掉
+        bst.build_from_sorted(keys.begin(), keys.end());
+        assert(bst.size() == 1000 && !bst.find(-1));
+        assert(bst.height() == 10); // floor(log2(1000)) + 1，完全平衡
+        assert(std::equal(bst.begin(), bst.end(), keys.begin(), keys.end()));
+        // parent 指针和 size 都要正确：反向迭代、顺序统计
+        std::vector<int> backward;
+        for (auto it = bst.end(); it != bst.begin();) backward.push_back(*--it);
+        assert(std::equal(backward.begin(), backward.end(), keys.rbegin(), keys.rend()));
+        assert(*bst.select(500) == 500 && bst.rank(250) == 250);
+
+        // 建好之后照常插入 / 删除
+        bst.insert(1000);
+        bst.remove(0);
+        assert(bst.size() == 1000 && *bst.begin() == 1 && *std::prev(bst.end()) == 1000);
+
+        // 相邻的重复元素只保留一个；只有前向迭代器也可以
+        std::list<int> with_duplicates = {1, 1, 2, 3, 3, 3, 4};
+        bst.build_from_sorted(with_duplicates.begin(), with_duplicates.end());
+        assert(bst.size() == 4 && std::is_sorted(bst.begin(), bst.end()));
+
+        // 无序输入：抛出异常，原来的树不变
+        std::vector<int> unsorted = {1, 3, 2};
+        bool thrown = false;
+        try {
+            bst.build_from_sorted(unsorted.begin(), unsorted.end());
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && bst.size() == 4);
+
+        // 用自己的迭代器重建：一棵退化成链的树被拉平衡
+        MyBST<int> chain;
+        for (int i = 0; i < 500; ++i) chain.insert(i);
+        assert(chain.height() == 500);
+        chain.build_from_sorted(chain.begin(), chain.end());
+        assert(chain.size() == 500 && chain.height() == 9);
+
+        bst.build_from_sorted(keys.begin(), keys.begin());
+        assert(bst.empty());
+    }
+
     void test_size_basic() {
         MyBST<int> bst;
         assert(bst.size() == 0);
@@ -376,12 +678,19 @@ void test_remove() {
     static const std::vector<TestCase> mybst_test_cases = {
         {"Insert and Find Test", test_insert_and_find},
         {"Traversals Test", test_traversals},
+        {"Deep Tree Traversals Test", test_deep_tree_traversals},
         {"Lower Bound Test", test_lower_bound},
         {"Upper Bound Test", test_upper_bound},
         {"Remove Test", test_remove},
         {"Resource Management (Copy/Assign)", test_resource_management},
         {"Size Basic Test", test_size_basic},
-        {"Size Copy/Assign Test", test_size_copy_and_assign}
+        {"Size Copy/Assign Test", test_size_copy_and_assign},
+        {"Iterators Test", test_iterators},
+        {"Deep Tree Operations Test", test_deep_tree_operations},
+        {"Traversal Benchmark", test_traversal_benchmark},
+        {"Order Statistics Test", test_order_statistics},
+        {"Range Queries Test", test_range_queries},
+        {"Build From Sorted Test", test_build_from_sorted}
     };
 
     // --- 实现管理函数 ---
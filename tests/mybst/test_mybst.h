@@ -7,6 +7,7 @@
 namespace TestMyBST {
     void test_insert_and_find();
     void test_traversals();
+    void test_deep_tree_traversals();
     void test_lower_bound();
     void test_upper_bound();
     void test_remove();
@@ -14,6 +15,12 @@ namespace TestMyBST {
     void run_all_tests();
     void test_size_basic();
     void test_size_copy_and_assign();
+    void test_iterators();
+    void test_deep_tree_operations();
+    void test_traversal_benchmark();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_build_from_sorted();
 
     const std::vector<TestCase>& get_test_cases();
 }
@@ -0,0 +1,201 @@
+#include "myconcurrenthashmap/test_myconcurrenthashmap.h"
+#include "common/test_common.h"
+#include "MyConcurrentHashMap.h"
+#include "MyHashMap.h"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace TestMyConcurrentHashMap {
+
+    void test_basic_operations() {
+        MyConcurrentHashMap<std::string, int> map(8);
+        assert(map.shard_count() == 8);
+        assert(map.empty());
+
+        map.insert("one", 1);
+        map.insert("two", 2);
+        assert(map.size() == 2);
+
+        int out = 0;
+        assert(map.find("one", out) && out == 1);
+        assert(!map.find("three", out));
+        assert(map.contains("two"));
+
+        map.insert("one", 111); // 覆盖
+        assert(map.find("one", out) && out == 111);
+        assert(map.size() == 2);
+
+        assert(map.erase("one"));
+        assert(!map.erase("one"));
+        assert(!map.contains("one"));
+        assert(map.size() == 1);
+
+        // 分片数会被向上取整到 2 的幂
+        MyConcurrentHashMap<int, int> odd(5);
+        assert(odd.shard_count() == 8);
+    }
+
+    void test_upsert_and_update() {
+        MyConcurrentHashMap<std::string, int> map;
+        assert(map.upsert("hits", [](int& v) { v += 1; }) == true);  // 新插入
+        assert(map.upsert("hits", [](int& v) { v += 1; }) == false); // 已存在
+        int out = 0;
+        assert(map.find("hits", out) && out == 2);
+
+        assert(map.update("hits", [](int& v) { v *= 10; }));
+        assert(map.find("hits", out) && out == 20);
+        assert(!map.update("missing", [](int& v) { v = 1; }));
+        assert(!map.contains("missing"));
+    }
+
+    // 多个线程对同一批 key 做原子自增，最终计数必须精确
+    void test_concurrent_upsert() {
+        MyConcurrentHashMap<int, long long> map(16);
+        const int threads = 8;
+        const int keys = 100;
+        const int rounds = 2000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&map, t] {
+                for (int r = 0; r < rounds; ++r) {
+                    map.upsert((r + t) % keys, [](long long& v) { ++v; });
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+
+        long long total = 0;
+        for (int k = 0; k < keys; ++k) {
+            long long v = 0;
+            assert(map.find(k, v));
+            total += v;
+        }
+        assert(total == static_cast<long long>(threads) * rounds);
+        assert(map.size() == static_cast<size_t>(keys));
+    }
+
+    // 每个线程负责一段互不重叠的 key，同时有其他线程在读
+    void test_concurrent_mixed() {
+        MyConcurrentHashMap<int, int> map;
+        const int writers = 4;
+        const int per_writer = 5000;
+        std::atomic<bool> done(false);
+
+        std::vector<std::thread> workers;
+        for (int w = 0; w < writers; ++w) {
+            workers.emplace_back([&map, w] {
+                int base = w * per_writer;
+                for (int i = 0; i < per_writer; ++i) map.insert(base + i, base + i);
+                for (int i = 0; i < per_writer; i += 2) map.erase(base + i);
+            });
+        }
+        std::thread reader([&map, &done] {
+            int out = 0;
+            while (!done.load()) {
+                for (int k = 0; k < 1000; ++k) {
+                    if (map.find(k, out)) assert(out == k); // 读到的值必须是完整的
+                }
+            }
+        });
+        for (auto& w : workers) w.join();
+        done.store(true);
+        reader.join();
+
+        assert(map.size() == static_cast<size_t>(writers * per_writer / 2));
+        for (int k = 0; k < writers * per_writer; ++k) {
+            assert(map.contains(k) == (k % 2 == 1));
+        }
+    }
+
+    // 用一把全局锁包住 MyHashMap，作为对照组
+    template <typename K, typename V>
+    class GlobalLockMap {
+    public:
+        void insert(const K& key, const V& value) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _map.insert(key, value);
+        }
+        bool find(const K& key, V& out) const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const V* v = _map.find(key);
+            if (!v) return false;
+            out = *v;
+            return true;
+        }
+    private:
+        mutable std::mutex _mutex;
+        MyHashMap<K, V> _map;
+    };
+
+    // 1 ~ 64 线程，读写比 90/10 与 50/50，总操作数固定
+    void test_scaling_benchmark() {
+        const int KEYS = 50000;
+        const int TOTAL_OPS = 200000;
+        std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+        auto run = [&](auto& map, int threads, int read_percent) {
+            for (int k = 0; k < KEYS; ++k) map.insert(k, k);
+            const int per_thread = TOTAL_OPS / threads;
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&map, t, per_thread, read_percent, KEYS] {
+                    std::mt19937 gen(t + 1);
+                    std::uniform_int_distribution<int> key_dist(0, KEYS - 1);
+                    std::uniform_int_distribution<int> pct(0, 99);
+                    int out = 0;
+                    for (int i = 0; i < per_thread; ++i) {
+                        int key = key_dist(gen);
+                        if (pct(gen) < read_percent) map.find(key, out);
+                        else map.insert(key, i);
+                    }
+                });
+            }
+            for (auto& w : workers) w.join();
+            auto end = std::chrono::steady_clock::now();
+            double secs = std::chrono::duration<double>(end - start).count();
+            return (per_thread * threads) / secs / 1e6; // Mops/s
+        };
+
+        for (int read_percent : {90, 50}) {
+            std::cout << "read " << read_percent << "% / write " << 100 - read_percent << "%" << std::endl;
+            for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+                MyConcurrentHashMap<int, int> sharded;
+                GlobalLockMap<int, int> global;
+                double sharded_mops = run(sharded, threads, read_percent);
+                double global_mops = run(global, threads, read_percent);
+                std::cout << "  threads=" << threads << ": sharded=" << sharded_mops
+                          << " Mops/s, global mutex=" << global_mops << " Mops/s" << std::endl;
+            }
+        }
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> myconcurrenthashmap_test_cases = {
+        {"Basic Operations Test", test_basic_operations},
+        {"Upsert and Update Test", test_upsert_and_update},
+        {"Concurrent Upsert Test", test_concurrent_upsert},
+        {"Concurrent Mixed Read/Write Test", test_concurrent_mixed},
+        {"Thread Scaling Benchmark", test_scaling_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return myconcurrenthashmap_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyConcurrentHashMap Tests");
+        for (const auto& test_case : myconcurrenthashmap_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyConcurrentHashMap Tests Complete");
+    }
+}
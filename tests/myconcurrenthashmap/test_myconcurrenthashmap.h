@@ -0,0 +1,18 @@
+#ifndef TEST_MYCONCURRENTHASHMAP_H
+#define TEST_MYCONCURRENTHASHMAP_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyConcurrentHashMap {
+    void test_basic_operations();
+    void test_upsert_and_update();
+    void test_concurrent_upsert();
+    void test_concurrent_mixed();
+    void test_scaling_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
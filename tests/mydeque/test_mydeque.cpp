@@ -2,7 +2,15 @@
 #include "mydeque/test_mydeque.h"
 #include "common/test_common.h"
 #include "MyDeque.h" // 确保包含了你的 Deque 头文件
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <deque>
+#include <numeric>
+#include <vector>
+#include <iostream>
+#include <random>
+#include <string>
 
 namespace TestMyDeque {
 
@@ -101,10 +109,326 @@ namespace TestMyDeque {
         }
     }
 
+    void test_deque_block_size() {
+        // 默认块大小按字节计算
+        static_assert(MyDeque<int>::block_size() == 128, "512 bytes of int");
+        static_assert(MyDeque<char>::block_size() == 512, "512 bytes of char");
+        static_assert(MyDeque<std::string>::block_size() >= 8, "at least 8 elements");
+
+        // 很小的块：随机的两端操作与 std::deque 逐一比对，频繁跨块、回收和复用块
+        MyDeque<std::string, 4> d;
+        std::deque<std::string> reference;
+        std::mt19937 rng(42);
+        for (int op = 0; op < 20000; ++op) {
+            unsigned r = rng() % 100;
+            std::string value = std::to_string(op);
+            if (r < 30) {
+                d.push_back(value);
+                reference.push_back(value);
+            }
+            else if (r < 60) {
+                d.push_front(value);
+                reference.push_front(value);
+            }
+            else if (r < 80 && !reference.empty()) {
+                d.pop_back();
+                reference.pop_back();
+            }
+            else if (!reference.empty()) {
+                d.pop_front();
+                reference.pop_front();
+            }
+            assert(d.size() == reference.size());
+            if (!reference.empty()) {
+                assert(d.front() == reference.front());
+                assert(d.back() == reference.back());
+                size_t i = rng() % reference.size();
+                assert(d[i] == reference[i]);
+            }
+            assert(d.spare_blocks() <= 4);
+        }
+    }
+
+    // 统计构造 / 析构次数，检查没有元素被重复构造或漏掉析构
+    struct Counted {
+        static int alive;
+        int value;
+        Counted(int v) : value(v) { alive++; }
+        Counted(const Counted& other) : value(other.value) { alive++; }
+        ~Counted() { alive--; }
+    };
+    int Counted::alive = 0;
+
+    void test_deque_block_recycling() {
+        {
+            // 队列式使用：稳定状态下块在两端之间循环复用，中控数组也不会一直扩容
+            MyDeque<Counted, 8> d;
+            for (int i = 0; i < 20; ++i) d.push_back(Counted(i));
+            for (int i = 20; i < 200000; ++i) {
+                d.push_back(Counted(i));
+                assert(d.front().value == i - 20);
+                d.pop_front();
+            }
+            assert(d.size() == 20 && Counted::alive == 20);
+            assert(d.spare_blocks() >= 1 && d.spare_blocks() <= 4);
+
+            // 一端取空之后，多出来的块进入缓存 (最多 4 个)，其余直接释放
+            while (!d.empty()) d.pop_back();
+            assert(Counted::alive == 0);
+            assert(d.spare_blocks() <= 4);
+            d.shrink_to_fit();
+            assert(d.spare_blocks() == 0);
+
+            for (int i = 0; i < 50; ++i) d.push_front(Counted(i));
+            assert(d.back().value == 0 && d.front().value == 49);
+        }
+        // 析构时析构所有剩余元素
+        assert(Counted::alive == 0);
+
+        // 拷贝 / 移动
+        MyDeque<std::string, 4> a;
+        for (int i = 0; i < 30; ++i) a.push_back(std::to_string(i));
+        MyDeque<std::string, 4> b(a);
+        assert(b.size() == 30 && b[0] == "0" && b[29] == "29");
+        b.pop_front();
+        assert(a.front() == "0" && b.front() == "1");
+        MyDeque<std::string, 4> c(std::move(b));
+        assert(c.size() == 29 && c.back() == "29");
+        a = c;
+        assert(a.size() == 29 && a.front() == "1");
+        c = MyDeque<std::string, 4>();
+        assert(c.empty());
+
+        // 被移走的对象是合法的空 deque，可以继续使用，而且不会碰到新主人的数据块
+        MyDeque<std::string, 4> src;
+        for (int i = 0; i < 5; ++i) src.push_back(std::to_string(i));
+        MyDeque<std::string, 4> dst(std::move(src));
+        assert(src.size() == 0 && src.empty());
+        assert(src.begin() == src.end());
+        for (int i = 0; i < 10; ++i) src.push_back("x" + std::to_string(i)); // 跨过块边界
+        src.push_front("front");
+        assert(src.size() == 11 && src.front() == "front" && src.back() == "x9");
+        assert(dst.size() == 5 && dst.front() == "0" && dst.back() == "4");
+
+        MyDeque<std::string, 4> assigned;
+        assigned.push_back("old");
+        dst = std::move(src);
+        assert(src.size() == 0 && src.empty());
+        assert(dst.size() == 11 && dst[1] == "x0");
+        src.push_front("again");
+        assert(src.size() == 1 && src.back() == "again");
+        assigned = std::move(dst);
+        assert(dst.empty() && assigned.size() == 11);
+    }
+
+    static volatile long long g_sink = 0;
+
+    void test_deque_benchmark() {
+        const int N = 1000000;
+        using Clock = std::chrono::steady_clock;
+        auto ms = [](Clock::time_point t0) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        };
+        auto run = [&](const char* label, auto& d) {
+            auto t0 = Clock::now();
+            for (int i = 0; i < N; ++i) d.push_back(i);
+            double push_ms = ms(t0);
+
+            t0 = Clock::now();
+            long long sum = 0;
+            for (size_t i = 0, n = d.size(); i < n; ++i) sum += d[i];
+            g_sink = sum; // 防止整个循环被优化掉
+            double index_ms = ms(t0);
+            assert(sum == static_cast<long long>(N) * (N - 1) / 2);
+
+            // 队列式：深度保持 1000
+            t0 = Clock::now();
+            while (d.size() > 1000) d.pop_front();
+            for (int i = 0; i < N; ++i) {
+                d.push_back(i);
+                d.pop_front();
+            }
+            double queue_ms = ms(t0);
+
+            std::cout << label << ": push_back " << push_ms << " ms, index scan " << index_ms
+                      << " ms, push_back+pop_front " << queue_ms << " ms" << std::endl;
+        };
+        MyDeque<int, 8> tiny_blocks;
+        MyDeque<int> default_blocks;
+        MyDeque<int, 1024> large_blocks;
+        std::deque<int> std_deque;
+        run("MyDeque<int, 8>     ", tiny_blocks);
+        run("MyDeque<int> (512 B)", default_blocks);
+        run("MyDeque<int, 1024>  ", large_blocks);
+        run("std::deque<int>     ", std_deque);
+    }
+
+    void test_deque_iterators() {
+        // 小块 + 两端都 push 过，begin 和 end 不在块的边界上
+        MyDeque<int, 4> d;
+        std::vector<int> reference;
+        std::mt19937 rng(1);
+        for (int i = 0; i < 50; ++i) d.push_back(static_cast<int>(rng() % 1000));
+        for (int i = 0; i < 23; ++i) d.push_front(static_cast<int>(rng() % 1000));
+        for (int x : d) reference.push_back(x); // range-for
+        assert(reference.size() == d.size());
+        for (size_t i = 0; i < reference.size(); ++i) assert(reference[i] == d[i]);
+
+        // 随机访问：+、-、[]、距离、比较
+        auto first = d.begin();
+        auto last = d.end();
+        const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(d.size());
+        assert(last - first == n && first - last == -n);
+        for (std::ptrdiff_t i = 0; i <= n; i += 3) {
+            auto it = first + i;
+            assert(it - first == i && last - it == n - i);
+            if (i < n) assert(*it == reference[i] && first[i] == reference[i]);
+            assert((it - i) == first && (i + first) == it);
+            assert(first <= it && it <= last && !(it > last));
+            for (std::ptrdiff_t j = 0; j <= n; j += 5) {
+                auto jt = first + j;
+                assert((jt - it) == j - i);
+                assert((it < jt) == (i < j));
+                auto kt = it;
+                kt += j - i;
+                assert(kt == jt);
+            }
+        }
+
+        // 反向走一遍
+        std::vector<int> backwards;
+        for (auto it = d.end(); it != d.begin();) backwards.push_back(*--it);
+        assert(std::equal(backwards.rbegin(), backwards.rend(), reference.begin()));
+
+        // std 算法：原地排序、二分查找、累加
+        std::sort(d.begin(), d.end());
+        std::sort(reference.begin(), reference.end());
+        assert(std::equal(d.begin(), d.end(), reference.begin()));
+        for (int probe : {0, 250, 500, 999, 1000}) {
+            auto it = std::lower_bound(d.begin(), d.end(), probe);
+            auto expected = std::lower_bound(reference.begin(), reference.end(), probe);
+            assert(it - d.begin() == expected - reference.begin());
+        }
+        assert(std::accumulate(d.begin(), d.end(), 0LL) == std::accumulate(reference.begin(), reference.end(), 0LL));
+
+        // const_iterator，以及 iterator -> const_iterator 的转换
+        const MyDeque<int, 4>& cd = d;
+        MyDeque<int, 4>::const_iterator cit = d.begin();
+        assert(cit == cd.begin() && *cit == reference[0]);
+        assert(std::is_sorted(cd.cbegin(), cd.cend()));
+        *d.begin() = -1;
+        assert(cd.front() == -1);
+
+        // 空 deque
+        MyDeque<int> empty;
+        assert(empty.begin() == empty.end() && empty.end() - empty.begin() == 0);
+    }
+
+    void test_deque_for_each_segment() {
+        MyDeque<int, 8> d;
+        for (int i = 0; i < 30; ++i) d.push_back(i);
+        for (int i = -1; i >= -13; --i) d.push_front(i);
+
+        // 各段首尾相接，按顺序覆盖全部元素，每段都不超过一个块
+        std::vector<int> seen;
+        size_t segments = 0;
+        d.for_each_segment([&](int* first, int* last) {
+            assert(first < last && last - first <= 8);
+            seen.insert(seen.end(), first, last);
+            segments++;
+        });
+        assert(seen.size() == d.size());
+        for (size_t i = 0; i < seen.size(); ++i) assert(seen[i] == d[i]);
+        assert(segments >= (d.size() + 7) / 8);
+
+        // 通过段内指针原地修改
+        d.for_each_segment([](int* first, int* last) {
+            for (int* p = first; p != last; ++p) *p *= 2;
+        });
+        assert(d.front() == -26 && d.back() == 58);
+
+        const MyDeque<int, 8>& cd = d;
+        long long sum = 0;
+        cd.for_each_segment([&](const int* first, const int* last) {
+            for (const int* p = first; p != last; ++p) sum += *p;
+        });
+        assert(sum == 2LL * (29 * 30 / 2 - 13 * 14 / 2));
+
+        MyDeque<int, 8> empty;
+        empty.for_each_segment([](int*, int*) { assert(false); });
+    }
+
+    void test_deque_algorithm_benchmark() {
+        const int N = 1000000;
+        using Clock = std::chrono::steady_clock;
+        auto ms = [](Clock::time_point t0) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        };
+        std::mt19937 rng(7);
+        MyDeque<int> d;
+        for (int i = 0; i < N; ++i) d.push_back(static_cast<int>(rng()));
+        MyDeque<int> d2(d);
+
+        // 1. 排序：原地 std::sort vs 拷出到 vector、排序、再拷回
+        auto t0 = Clock::now();
+        std::sort(d.begin(), d.end());
+        double in_place_ms = ms(t0);
+
+        t0 = Clock::now();
+        std::vector<int> buffer(d2.begin(), d2.end());
+        std::sort(buffer.begin(), buffer.end());
+        std::copy(buffer.begin(), buffer.end(), d2.begin());
+        double copy_out_ms = ms(t0);
+        assert(std::equal(d.begin(), d.end(), d2.begin()));
+        std::cout << "sort " << N << " ints: in place " << in_place_ms << " ms, copy out + sort + copy back "
+                  << copy_out_ms << " ms" << std::endl;
+
+        // 2. 线性扫描
+        long long expected = 0;
+        for (int x : buffer) expected += x;
+        auto scan = [&](const char* label, auto body) {
+            auto start = Clock::now();
+            long long sum = body();
+            g_sink = sum;
+            double elapsed = ms(start);
+            assert(sum == expected);
+            std::cout << label << elapsed << " ms" << std::endl;
+        };
+        scan("scan via operator[]          : ", [&] {
+            long long sum = 0;
+            for (size_t i = 0, n = d.size(); i < n; ++i) sum += d[i];
+            return sum;
+        });
+        scan("scan via iterator (range-for): ", [&] {
+            long long sum = 0;
+            for (int x : d) sum += x;
+            return sum;
+        });
+        scan("scan via for_each_segment    : ", [&] {
+            long long sum = 0;
+            d.for_each_segment([&](const int* first, const int* last) {
+                for (const int* p = first; p != last; ++p) sum += *p;
+            });
+            return sum;
+        });
+        scan("copy out to vector + scan    : ", [&] {
+            std::vector<int> copy(d.begin(), d.end());
+            long long sum = 0;
+            for (int x : copy) sum += x;
+            return sum;
+        });
+    }
+
     // --- 测试用例注册表 ---
     static const std::vector<TestCase> deque_test_cases = {
         {"Deque Basic Operations and Block Crossing", test_deque_operations},
-        {"Deque Map Reallocation Stress Test", test_deque_reallocation}
+        {"Deque Map Reallocation Stress Test", test_deque_reallocation},
+        {"Deque Block Size Test", test_deque_block_size},
+        {"Deque Block Recycling Test", test_deque_block_recycling},
+        {"Deque Benchmark", test_deque_benchmark},
+        {"Deque Iterators Test", test_deque_iterators},
+        {"Deque For Each Segment Test", test_deque_for_each_segment},
+        {"Deque Algorithm Benchmark", test_deque_algorithm_benchmark}
     };
 
     // --- get_test_cases ---
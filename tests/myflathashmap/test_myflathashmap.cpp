@@ -0,0 +1,210 @@
+#include "myflathashmap/test_myflathashmap.h"
+#include "common/test_common.h"
+#include "MyFlatHashMap.h"
+#include "MyHashMap.h"
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace TestMyFlatHashMap {
+
+    void test_insert_and_access() {
+        MyFlatHashMap<std::string, int> map;
+        assert(map.size() == 0);
+
+        map.insert("one", 1);
+        map.insert("two", 2);
+        assert(map.size() == 2);
+        assert(map["one"] == 1);
+        assert(map["two"] == 2);
+
+        // insert 已存在的 key 只更新 value
+        map.insert("one", 111);
+        assert(map.size() == 2);
+        assert(map["one"] == 111);
+
+        // operator[] 访问不存在的 key 时创建默认值
+        assert(map["three"] == 0);
+        assert(map.size() == 3);
+
+        map["four"] = 4;
+        map["two"] = 222;
+        assert(map["four"] == 4);
+        assert(map["two"] == 222);
+        assert(map.size() == 4);
+    }
+
+    void test_find_and_erase() {
+        MyFlatHashMap<std::string, int> map;
+        map.insert("one", 1);
+        map.insert("two", 2);
+        map.insert("three", 3);
+
+        int* val_ptr = map.find("two");
+        assert(val_ptr != nullptr && *val_ptr == 2);
+        assert(map.find("four") == nullptr);
+
+        *val_ptr = 22;
+        assert(map["two"] == 22);
+
+        assert(map.erase("one"));
+        assert(map.size() == 2);
+        assert(map.find("one") == nullptr);
+        assert(!map.erase("five"));
+        assert(map.size() == 2);
+
+        assert(map["two"] == 22);
+        assert(map["three"] == 3);
+
+        map.erase("two");
+        map.erase("three");
+        assert(map.size() == 0);
+        assert(map.empty());
+    }
+
+    void test_rehash() {
+        // 容量是 2 的幂，负载因子超过 0.875 时翻倍
+        MyFlatHashMap<int, std::string> map(8);
+        assert(map.bucket_count() == 8);
+
+        for (int i = 0; i < 7; ++i) map.insert(i, std::to_string(i));
+        assert(map.bucket_count() == 8);  // 7 / 8 = 0.875，还没触发
+
+        map.insert(7, "7");
+        assert(map.bucket_count() == 16); // 8 / 8 > 0.875，触发扩容
+
+        for (int i = 0; i < 8; ++i) {
+            assert(map.find(i) != nullptr && *map.find(i) == std::to_string(i));
+        }
+
+        // 非 2 的幂的初始容量会被向上取整
+        MyFlatHashMap<int, int> odd(10);
+        assert(odd.bucket_count() == 16);
+    }
+
+    // 随机插入/删除/查找，并与 std::unordered_map 逐一比对，重点覆盖反向移位删除
+    void test_randomized_against_std() {
+        MyFlatHashMap<int, int> map(4);
+        std::unordered_map<int, int> reference;
+        std::mt19937 gen(12345);
+        std::uniform_int_distribution<int> key_dist(0, 2000);
+        std::uniform_int_distribution<int> op_dist(0, 2);
+
+        for (int step = 0; step < 50000; ++step) {
+            int key = key_dist(gen);
+            switch (op_dist(gen)) {
+                case 0:
+                    map.insert(key, step);
+                    reference[key] = step;
+                    break;
+                case 1: {
+                    bool erased = map.erase(key);
+                    assert(erased == (reference.erase(key) == 1));
+                    break;
+                }
+                default: {
+                    int* found = map.find(key);
+                    auto it = reference.find(key);
+                    assert((found != nullptr) == (it != reference.end()));
+                    if (found) assert(*found == it->second);
+                    break;
+                }
+            }
+            assert(map.size() == reference.size());
+        }
+        for (const auto& kv : reference) {
+            assert(map.find(kv.first) != nullptr && *map.find(kv.first) == kv.second);
+        }
+    }
+
+    void test_copy_and_move() {
+        MyFlatHashMap<std::string, int> a;
+        for (int i = 0; i < 100; ++i) a.insert("k" + std::to_string(i), i);
+
+        // 拷贝是深拷贝
+        MyFlatHashMap<std::string, int> b = a;
+        assert(b.size() == 100);
+        b["k0"] = -1;
+        assert(*a.find("k0") == 0);
+
+        MyFlatHashMap<std::string, int> c;
+        c.insert("x", 1);
+        c = a;
+        assert(c.size() == 100 && *c.find("k99") == 99);
+        c = c;
+        assert(c.size() == 100);
+
+        // 移动后源对象为空，但仍然可以继续使用
+        MyFlatHashMap<std::string, int> d = std::move(a);
+        assert(d.size() == 100 && *d.find("k42") == 42);
+        assert(a.size() == 0 && a.find("k42") == nullptr);
+        a["again"] = 7;
+        assert(a.size() == 1 && *a.find("again") == 7);
+
+        d.clear();
+        assert(d.empty() && d.find("k1") == nullptr);
+    }
+
+    // 开放寻址 vs 链式 MyHashMap vs std::unordered_map
+    void test_benchmark() {
+        const int N = 200000;
+        std::mt19937_64 gen(42);
+        std::vector<long long> keys(N);
+        for (auto& k : keys) k = static_cast<long long>(gen() >> 1);
+
+        // found(map.find(key)) 判断是否命中：MyHashMap / MyFlatHashMap 的 find 返回指针，std::unordered_map 返回迭代器
+        auto run = [&](const char* label, auto& map, auto found) {
+            auto t0 = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < N; ++i) map[keys[i]] = i;
+            auto t1 = std::chrono::high_resolution_clock::now();
+            long long hits = 0;
+            for (int i = 0; i < N; ++i) hits += found(map.find(keys[i]));
+            auto t2 = std::chrono::high_resolution_clock::now();
+            long long misses = 0;
+            for (int i = 0; i < N; ++i) misses += !found(map.find(-keys[i] - 1));
+            auto t3 = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < N; i += 2) map.erase(keys[i]);
+            auto t4 = std::chrono::high_resolution_clock::now();
+            assert(hits == N && misses == N);
+
+            auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+            std::cout << label << ": insert=" << ms(t0, t1) << " ms, hit=" << ms(t1, t2)
+                      << " ms, miss=" << ms(t2, t3) << " ms, erase=" << ms(t3, t4) << " ms" << std::endl;
+        };
+
+        MyHashMap<long long, int> chained;
+        MyFlatHashMap<long long, int> flat;
+        std::unordered_map<long long, int> std_map;
+        std::cout << "N = " << N << std::endl;
+        auto found_ptr = [](const int* value) { return value != nullptr; };
+        run("MyHashMap (chained)   ", chained, found_ptr);
+        run("MyFlatHashMap (robin) ", flat, found_ptr);
+        run("std::unordered_map    ", std_map, [&std_map](auto it) { return it != std_map.end(); });
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> myflathashmap_test_cases = {
+        {"Insert and Access Test", test_insert_and_access},
+        {"Find and Erase Test", test_find_and_erase},
+        {"Rehash Test", test_rehash},
+        {"Randomized vs std::unordered_map", test_randomized_against_std},
+        {"Copy and Move Test", test_copy_and_move},
+        {"Benchmark vs Chained and std", test_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return myflathashmap_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyFlatHashMap Tests");
+        for (const auto& test_case : myflathashmap_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyFlatHashMap Tests Complete");
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef TEST_MYFLATHASHMAP_H
+#define TEST_MYFLATHASHMAP_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyFlatHashMap {
+    void test_insert_and_access();
+    void test_find_and_erase();
+    void test_rehash();
+    void test_randomized_against_std();
+    void test_copy_and_move();
+    void test_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
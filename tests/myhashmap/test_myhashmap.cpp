@@ -1,8 +1,16 @@
 #include "myhashmap/test_myhashmap.h"
 #include "common/test_common.h"
 #include "MyHashMap.h"
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cctype>
+#include <list>
+#include <random>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace TestMyHashMap {
 
@@ -86,7 +94,7 @@ namespace TestMyHashMap {
     // ... test_find_and_erase() ...
 
     void test_rehash() {
-        // 我们的 MAX_LOAD_FACTOR 是 0.75
+        // 默认的 max_load_factor() 是 0.75
         // 构造一个初始桶数为 4 的 map
         // 当 size 达到 4 * 0.75 = 3 时，下一次 insert (size变为4) 就会触发 rehash
         MyHashMap<int, std::string> map(4);
@@ -133,11 +141,440 @@ namespace TestMyHashMap {
     }
 
 
+    void test_incremental_rehash() {
+        MyHashMap<int, int> map(4);
+        map.set_incremental_rehash(true, 1); // 每次操作只搬迁 1 个旧桶，方便观察中间状态
+        assert(map.incremental_rehash());
+
+        map.insert(1, 10);
+        map.insert(2, 20);
+        map.insert(3, 30);
+        assert(!map.is_rehashing());
+
+        // size 变为 4，触发扩容：新桶数组立即生效，但旧桶还没有搬迁
+        map.insert(4, 40);
+        assert(map.bucket_count() == 8);
+        assert(map.is_rehashing());
+
+        // 搬迁期间，新旧两个桶数组中的 key 都必须能被找到
+        for (int i = 1; i <= 4; ++i) {
+            assert(map.find(i) != nullptr && *map.find(i) == i * 10);
+        }
+
+        // 搬迁期间的更新、删除和新插入
+        map.insert(1, 11);
+        assert(*map.find(1) == 11);
+        assert(map.erase(3));
+        assert(map.find(3) == nullptr);
+        map[5] = 50;
+        assert(map.size() == 4);
+
+        // 已经搬迁了 3 个旧桶，再操作一次，4 个旧桶就全部搬完了
+        map.insert(100, 0);
+        assert(!map.is_rehashing());
+        assert(map.size() == 5);
+        assert(*map.find(1) == 11 && *map.find(2) == 20 && *map.find(4) == 40 && *map.find(5) == 50);
+        assert(map.find(3) == nullptr);
+
+        // 大量数据下与逐个校验
+        MyHashMap<int, int> big;
+        big.set_incremental_rehash(true);
+        for (int i = 0; i < 20000; ++i) {
+            big.insert(i, i * 2);
+            if (i % 3 == 0) assert(big.erase(i / 2) || big.find(i / 2) == nullptr);
+        }
+        for (int i = 0; i < 20000; ++i) {
+            const int* v = big.find(i);
+            if (v) assert(*v == i * 2);
+        }
+
+        // 关闭渐进模式时会立刻完成搬迁
+        big.insert(-1, -1);
+        big.set_incremental_rehash(false);
+        assert(!big.is_rehashing());
+        assert(*big.find(-1) == -1);
+    }
+
+    // 所有 key 都落在同一个桶里的“最坏”哈希函数
+    struct ConstantHash {
+        size_t operator()(int) const { return 42; }
+    };
+
+    // 忽略大小写的哈希与比较
+    struct CaseInsensitiveHash {
+        size_t operator()(const std::string& s) const {
+            std::string lower;
+            for (char c : s) lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return std::hash<std::string>{}(lower);
+        }
+    };
+    struct CaseInsensitiveEqual {
+        bool operator()(const std::string& a, const std::string& b) const {
+            if (a.size() != b.size()) return false;
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    void test_custom_hash_and_equal() {
+        // 1. 桶数会被向上取整到 2 的幂
+        MyHashMap<int, int> odd(10);
+        assert(odd.bucket_count() == 16);
+
+        // 2. 所有 key 冲突时依然正确 (全部挂在同一个桶的链表上)
+        MyHashMap<int, int, ConstantHash> collide(4);
+        for (int i = 0; i < 100; ++i) collide.insert(i, i * i);
+        assert(collide.size() == 100);
+        for (int i = 0; i < 100; ++i) assert(*collide.find(i) == i * i);
+        assert(collide.erase(50));
+        assert(collide.find(50) == nullptr);
+        assert(collide.size() == 99);
+
+        // 3. 自定义 KeyEqual：大小写不同的 key 视为同一个
+        MyHashMap<std::string, int, CaseInsensitiveHash, CaseInsensitiveEqual> ci;
+        ci.insert("Hello", 1);
+        ci.insert("HELLO", 2);
+        assert(ci.size() == 1);
+        assert(*ci.find("hello") == 2);
+        assert(ci.erase("hElLo"));
+        assert(ci.size() == 0);
+    }
+
+    void test_heterogeneous_lookup() {
+        MyHashMap<std::string, int> map;
+        map.insert("alpha", 1);
+        map.insert("beta", 2);
+
+        // 用 std::string_view 查找，不需要构造临时的 std::string
+        std::string_view sv = "alpha";
+        int* found = map.find(sv);
+        assert(found != nullptr && *found == 1);
+
+        // 从一个更长的缓冲区中截取出来的 string_view 同样可以
+        std::string buffer = "xxbetaxx";
+        std::string_view slice(buffer.data() + 2, 4);
+        assert(map.find(slice) != nullptr && *map.find(slice) == 2);
+        assert(map.find(std::string_view("gamma")) == nullptr);
+
+        // const 版本
+        const MyHashMap<std::string, int>& cref = map;
+        assert(cref.find(std::string_view("beta")) != nullptr);
+
+        // 渐进式 rehash 期间也能正常工作
+        map.set_incremental_rehash(true, 1);
+        for (int i = 0; i < 40; ++i) map.insert("k" + std::to_string(i), i);
+        for (int i = 0; i < 40; ++i) {
+            std::string key = "k" + std::to_string(i);
+            assert(*map.find(std::string_view(key)) == i);
+        }
+    }
+
+    // 统计拷贝次数的 value 类型
+    struct CopyCounter {
+        static int copies;
+        int value;
+        CopyCounter(int v = 0) : value(v) {}
+        CopyCounter(const CopyCounter& other) : value(other.value) { ++copies; }
+        CopyCounter& operator=(const CopyCounter& other) { value = other.value; ++copies; return *this; }
+    };
+    int CopyCounter::copies = 0;
+
+    void test_reserve_and_load_factor() {
+        // 1. reserve 之后插入 n 个元素都不会再 rehash
+        MyHashMap<int, int> map;
+        assert(map.max_load_factor() == 0.75);
+        map.reserve(1000);
+        size_t reserved = map.bucket_count();
+        assert(reserved == 2048); // 1000 / 0.75 ≈ 1334，向上取整到 2 的幂
+        for (int i = 0; i < 1000; ++i) map.insert(i, i);
+        assert(map.bucket_count() == reserved);
+        assert(map.load_factor() <= map.max_load_factor());
+
+        // reserve 一个更小的值什么都不做
+        map.reserve(10);
+        assert(map.bucket_count() == reserved);
+
+        // 2. 调小 max_load_factor 会立刻扩容，数据保持不变
+        map.max_load_factor(0.25);
+        assert(map.bucket_count() == 4096);
+        assert(map.load_factor() <= 0.25);
+        for (int i = 0; i < 1000; ++i) assert(*map.find(i) == i);
+
+        // 3. 调大之后可以装得更满
+        MyHashMap<int, int> dense(4);
+        dense.max_load_factor(2.0);
+        for (int i = 0; i < 8; ++i) dense.insert(i, i);
+        assert(dense.bucket_count() == 4);
+        dense.insert(8, 8);
+        assert(dense.bucket_count() == 8);
+    }
+
+    void test_rehash_moves_nodes() {
+        MyHashMap<int, CopyCounter> map(4);
+        map.insert(0, CopyCounter(0));
+        CopyCounter* first = map.find(0);
+
+        // 之后的若干次扩容都只是重新挂链表节点，value 不会被拷贝，地址也不变
+        for (int i = 1; i < 5000; ++i) map.insert(i, CopyCounter(i));
+        int copies_after_insert = CopyCounter::copies;
+        map.reserve(100000);
+        assert(CopyCounter::copies == copies_after_insert);
+        assert(map.find(0) == first);
+
+        // 每个元素只在插入时拷贝了固定次数，与 rehash 的次数无关
+        CopyCounter::copies = 0;
+        MyHashMap<int, CopyCounter> probe(4);
+        probe.insert(0, CopyCounter(0));
+        int per_insert = CopyCounter::copies;
+        CopyCounter::copies = 0;
+        for (int i = 1; i <= 1000; ++i) probe.insert(i, CopyCounter(i));
+        assert(CopyCounter::copies == per_insert * 1000);
+
+        // operator[] 返回的引用在它自己触发的扩容之后依然有效
+        MyHashMap<int, int> small(4);
+        small.insert(1, 1);
+        small.insert(2, 2);
+        small.insert(3, 3);
+        int& ref = small[4]; // size 变为 4，触发 rehash
+        assert(small.bucket_count() == 8);
+        ref = 44;
+        assert(*small.find(4) == 44);
+
+        // 渐进式搬迁同样只是挂节点
+        MyHashMap<int, CopyCounter> inc(4);
+        inc.set_incremental_rehash(true, 1);
+        CopyCounter::copies = 0;
+        for (int i = 0; i < 1000; ++i) inc.insert(i, CopyCounter(i));
+        assert(CopyCounter::copies == per_insert * 1000);
+        for (int i = 0; i < 1000; ++i) assert(inc.find(i)->value == i);
+    }
+
+    // 从空表开始插入：重新挂节点的 rehash vs 预先 reserve
+    void test_growth_benchmark() {
+        const int N = 500000;
+        std::vector<std::string> keys(N);
+        for (int i = 0; i < N; ++i) keys[i] = "key-" + std::to_string(static_cast<long long>(i) * 7919);
+
+        auto run = [&](const char* label, bool reserve_first) {
+            MyHashMap<std::string, int> map;
+            auto t0 = std::chrono::steady_clock::now();
+            if (reserve_first) map.reserve(N);
+            for (int i = 0; i < N; ++i) map.insert(keys[i], i);
+            auto t1 = std::chrono::steady_clock::now();
+            assert(map.size() == static_cast<size_t>(N));
+            std::cout << label << ": " << N << " inserts in "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        };
+        run("grow from 16 buckets", false);
+        run("reserve(N) first    ", true);
+    }
+
+    void test_insert_bulk_and_find_batch() {
+        // 1. 前向迭代器：最多扩容一次，重复的 key 以后出现的为准
+        std::vector<std::pair<int, int>> input;
+        for (int i = 0; i < 1000; ++i) input.push_back({i, i * 2});
+        input.push_back({5, -5});
+
+        MyHashMap<int, int> map(4);
+        map.insert(-1, -1);
+        map.insert_bulk(input.begin(), input.end());
+        assert(map.size() == 1001);
+        assert(*map.find(5) == -5);
+        assert(*map.find(-1) == -1);
+        assert(map.load_factor() <= map.max_load_factor());
+
+        // 其他容器 (双向迭代器) 也可以
+        std::list<std::pair<std::string, int>> words = {{"a", 1}, {"b", 2}};
+        MyHashMap<std::string, int> wmap;
+        wmap.insert_bulk(words.begin(), words.end());
+        assert(wmap.size() == 2 && *wmap.find("b") == 2);
+
+        // 2. find_batch：结果与逐个 find 一致
+        std::vector<int> keys;
+        for (int i = -50; i < 1100; i += 3) keys.push_back(i);
+        std::vector<int*> out;
+        size_t found = map.find_batch(keys, out);
+        assert(out.size() == keys.size());
+        size_t expected = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            assert(out[i] == map.find(keys[i]));
+            if (out[i]) ++expected;
+        }
+        assert(found == expected);
+
+        // 通过返回的指针可以修改 value
+        MyVector<int> one;
+        one.push_back(7);
+        MyVector<int*> one_out;
+        assert(map.find_batch(one, one_out) == 1);
+        *one_out[0] = 700;
+        assert(*map.find(7) == 700);
+
+        // 空批次
+        std::vector<int> none;
+        assert(map.find_batch(none, out) == 0 && out.empty());
+
+        // 3. 渐进式 rehash 期间，还没搬迁的旧桶里的 key 也能找到
+        MyHashMap<int, int> inc(4);
+        inc.set_incremental_rehash(true, 1);
+        for (int i = 0; i < 200; ++i) inc.insert(i, i);
+        std::vector<int> all;
+        for (int i = 0; i < 200; ++i) all.push_back(i);
+        assert(inc.find_batch(all, out) == 200);
+        for (int i = 0; i < 200; ++i) assert(*out[i] == i);
+    }
+
+    // 大表上的随机查找：逐个 find vs find_batch (预取)
+    void test_find_batch_benchmark() {
+        const int N = 1000000;
+        const int Q = 1000000;
+        std::vector<std::pair<int, int>> input(N);
+        std::mt19937 gen(2024);
+        for (int i = 0; i < N; ++i) input[i] = {static_cast<int>(gen()), i};
+
+        MyHashMap<int, int> map;
+        auto b0 = std::chrono::steady_clock::now();
+        map.insert_bulk(input.begin(), input.end());
+        auto b1 = std::chrono::steady_clock::now();
+        std::cout << "insert_bulk: " << N << " pairs in "
+                  << std::chrono::duration<double, std::milli>(b1 - b0).count() << " ms" << std::endl;
+
+        std::vector<int> probes(Q);
+        std::uniform_int_distribution<int> pick(0, N - 1);
+        for (int q = 0; q < Q; ++q) {
+            // 一半命中，一半未命中
+            probes[q] = (q & 1) ? input[pick(gen)].first : static_cast<int>(gen());
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        size_t single_found = 0;
+        for (int q = 0; q < Q; ++q) single_found += (map.find(probes[q]) != nullptr);
+        auto t1 = std::chrono::steady_clock::now();
+        std::vector<int*> out;
+        size_t batch_found = map.find_batch(probes, out);
+        auto t2 = std::chrono::steady_clock::now();
+
+        assert(single_found == batch_found);
+        std::cout << "single find loop: " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "find_batch      : " << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+    }
+
+    void test_intrusive_buckets() {
+        using IntrusiveMap = MyHashMap<std::string, int, MyHash<std::string>, std::equal_to<>, MyIntrusiveBuckets>;
+        IntrusiveMap map(4);
+        for (int i = 0; i < 1000; ++i) map.insert("k" + std::to_string(i), i);
+        assert(map.size() == 1000);
+        map["k5"] = 55;
+        assert(*map.find("k5") == 55);
+        assert(*map.find(std::string_view("k999")) == 999);
+        for (int i = 0; i < 1000; i += 2) assert(map.erase("k" + std::to_string(i)));
+        assert(map.size() == 500 && map.find("k0") == nullptr && *map.find("k1") == 1);
+
+        // 拷贝是深拷贝，移动之后原表依然可用
+        IntrusiveMap copy = map;
+        *copy.find("k1") = -1;
+        assert(*map.find("k1") == 1 && copy.size() == 500);
+        IntrusiveMap moved = std::move(copy);
+        assert(moved.size() == 500 && *moved.find("k1") == -1);
+        assert(copy.size() == 0 && copy.find("k1") == nullptr);
+        copy.insert("again", 1);
+        assert(*copy.find("again") == 1);
+        copy = map;
+        assert(copy.size() == 500 && copy.find("again") == nullptr);
+
+        // 渐进式 rehash 同样适用
+        IntrusiveMap inc(4);
+        inc.set_incremental_rehash(true, 1);
+        for (int i = 0; i < 300; ++i) inc.insert(std::to_string(i), i);
+        assert(inc.is_rehashing() || inc.size() == 300);
+        IntrusiveMap inc_copy = inc; // 拷贝正在搬迁中的表
+        for (int i = 0; i < 300; ++i) {
+            assert(*inc.find(std::to_string(i)) == i);
+            assert(*inc_copy.find(std::to_string(i)) == i);
+        }
+        for (int i = 0; i < 300; ++i) assert(inc.erase(std::to_string(i)));
+        assert(inc.size() == 0);
+
+        // 默认的 MyLinkedList 桶也支持同样的拷贝 / 移动语义
+        MyHashMap<int, int> plain;
+        plain.insert(1, 1);
+        MyHashMap<int, int> plain_moved = std::move(plain);
+        assert(plain.size() == 0 && plain.find(1) == nullptr);
+        plain.insert(2, 2);
+        assert(*plain.find(2) == 2 && *plain_moved.find(1) == 1);
+    }
+
+    // MyLinkedList 桶 vs 侵入式桶：插入、命中查找、删除
+    void test_bucket_list_benchmark() {
+        const int N = 300000;
+        std::vector<int> keys(N);
+        std::mt19937 gen(11);
+        for (int i = 0; i < N; ++i) keys[i] = static_cast<int>(gen());
+
+        auto run = [&](const char* label, auto map) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < N; ++i) map.insert(keys[i], i);
+            auto t1 = std::chrono::steady_clock::now();
+            long long hits = 0;
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < N; ++i) hits += (map.find(keys[i]) != nullptr);
+            }
+            auto t2 = std::chrono::steady_clock::now();
+            for (int i = 0; i < N; ++i) map.erase(keys[i]);
+            auto t3 = std::chrono::steady_clock::now();
+            assert(hits == 3LL * N && map.size() == 0);
+            auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+            std::cout << label << ": insert " << ms(t0, t1) << " ms, find x3 " << ms(t1, t2)
+                      << " ms, erase " << ms(t2, t3) << " ms" << std::endl;
+        };
+        run("MyLinkedList buckets   ", MyHashMap<int, int>());
+        run("MyIntrusiveList buckets", MyHashMap<int, int, MyHash<int>, std::equal_to<>, MyIntrusiveBuckets>());
+    }
+
+    // 插入延迟分布：一次性 rehash vs 渐进式 rehash
+    void test_insert_latency_benchmark() {
+        const int N = 300000;
+        auto measure = [&](const char* label, bool incremental) {
+            MyHashMap<int, int> map;
+            map.set_incremental_rehash(incremental);
+            std::vector<double> samples;
+            samples.reserve(N);
+            for (int i = 0; i < N; ++i) {
+                auto t0 = std::chrono::steady_clock::now();
+                map.insert(i, i);
+                auto t1 = std::chrono::steady_clock::now();
+                samples.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            }
+            assert(map.size() == static_cast<size_t>(N));
+            std::sort(samples.begin(), samples.end());
+            auto pct = [&](double p) { return samples[static_cast<size_t>(p * (samples.size() - 1))]; };
+            std::cout << label << ": p50=" << pct(0.50) << " us, p99=" << pct(0.99)
+                      << " us, p99.9=" << pct(0.999) << " us, max=" << samples.back() << " us" << std::endl;
+        };
+        measure("stop-the-world rehash", false);
+        measure("incremental rehash   ", true);
+    }
+
     // --- 创建测试用例注册表 ---
     static const std::vector<TestCase> myhashmap_test_cases = {
         {"Insert and Access Test", test_insert_and_access},
         {"Find and Erase Test", test_find_and_erase},
-        {"Rehash Test", test_rehash}
+        {"Rehash Test", test_rehash},
+        {"Incremental Rehash Test", test_incremental_rehash},
+        {"Custom Hash and KeyEqual Test", test_custom_hash_and_equal},
+        {"Heterogeneous Lookup Test", test_heterogeneous_lookup},
+        {"Reserve and Load Factor Test", test_reserve_and_load_factor},
+        {"Rehash Moves Nodes Test", test_rehash_moves_nodes},
+        {"Insert Bulk and Find Batch Test", test_insert_bulk_and_find_batch},
+        {"Intrusive Buckets Test", test_intrusive_buckets},
+        {"Insert Latency Benchmark", test_insert_latency_benchmark},
+        {"Growth Benchmark", test_growth_benchmark},
+        {"Find Batch Benchmark", test_find_batch_benchmark},
+        {"Bucket List Benchmark", test_bucket_list_benchmark}
     };
 
     // --- 实现管理函数 ---
@@ -8,6 +8,17 @@ namespace TestMyHashMap {
     void test_insert_and_access();
     void test_find_and_erase();
     void test_rehash();
+    void test_incremental_rehash();
+    void test_custom_hash_and_equal();
+    void test_heterogeneous_lookup();
+    void test_reserve_and_load_factor();
+    void test_rehash_moves_nodes();
+    void test_insert_bulk_and_find_batch();
+    void test_intrusive_buckets();
+    void test_insert_latency_benchmark();
+    void test_growth_benchmark();
+    void test_find_batch_benchmark();
+    void test_bucket_list_benchmark();
     void run_all_tests();
 
     const std::vector<TestCase>& get_test_cases();
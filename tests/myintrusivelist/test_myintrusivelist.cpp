@@ -0,0 +1,178 @@
+#include "myintrusivelist/test_myintrusivelist.h"
+#include "common/test_common.h"
+#include "MyIntrusiveList.h"
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace TestMyIntrusiveList {
+
+    struct Item : MyIntrusiveHook<> {
+        int value;
+        explicit Item(int v = 0) : value(v) {}
+    };
+
+    static std::vector<int> values(const MyIntrusiveList<Item>& list) {
+        std::vector<int> out;
+        for (auto it = list.begin(); it != list.end(); ++it) out.push_back(it->value);
+        return out;
+    }
+
+    void test_push_pop_and_iterate() {
+        Item a(1), b(2), c(3);
+        MyIntrusiveList<Item> list;
+        assert(list.empty());
+
+        list.push_back(b);
+        list.push_back(c);
+        list.push_front(a);
+        assert(list.size() == 3);
+        assert(&list.front() == &a && &list.back() == &c); // 链表里就是对象本身，没有拷贝
+        assert((values(list) == std::vector<int>{1, 2, 3}));
+
+        // 通过迭代器修改对象
+        for (auto it = list.begin(); it != list.end(); ++it) it->value *= 10;
+        assert(a.value == 10 && c.value == 30);
+
+        auto it = list.begin();
+        ++it;
+        ++it;
+        --it;
+        assert(&*it == &b);
+
+        list.pop_front();
+        list.pop_back();
+        assert(list.size() == 1 && &list.front() == &b);
+        list.pop_back();
+        assert(list.empty());
+
+        bool thrown = false;
+        try { list.front(); } catch (const std::out_of_range&) { thrown = true; }
+        assert(thrown);
+    }
+
+    void test_insert_erase_remove() {
+        std::vector<Item> items;
+        for (int i = 0; i < 5; ++i) items.emplace_back(i);
+        MyIntrusiveList<Item> list;
+        for (auto& item : items) list.push_back(item);
+
+        // O(1)：拿着对象本身直接摘掉
+        list.remove(items[2]);
+        assert((values(list) == std::vector<int>{0, 1, 3, 4}));
+
+        // iterator_to + insert：把 2 放回 3 的前面
+        auto pos = MyIntrusiveList<Item>::iterator_to(items[3]);
+        auto inserted = list.insert(pos, items[2]);
+        assert(&*inserted == &items[2]);
+        assert((values(list) == std::vector<int>{0, 1, 2, 3, 4}));
+
+        // erase 返回下一个元素，对象本身不会被销毁
+        auto next = list.erase(MyIntrusiveList<Item>::iterator_to(items[0]));
+        assert(&*next == &items[1]);
+        assert(items[0].value == 0);
+        next = list.erase(MyIntrusiveList<Item>::iterator_to(items[4]));
+        assert(next == list.end());
+        assert((values(list) == std::vector<int>{1, 2, 3}));
+
+        // 析构链表只是摘下元素
+        {
+            MyIntrusiveList<Item> temp;
+            temp.push_back(items[0]);
+        }
+        list.push_front(items[0]);
+        assert(list.size() == 4 && list.front().value == 0);
+        list.clear();
+        assert(list.empty());
+    }
+
+    struct LruTag {};
+
+    // 同一个对象同时挂在两条链表上
+    struct Entry : MyIntrusiveHook<>, MyIntrusiveHook<LruTag> {
+        int key;
+        explicit Entry(int k) : key(k) {}
+    };
+
+    void test_multiple_hooks() {
+        Entry e1(1), e2(2), e3(3);
+        MyIntrusiveList<Entry> bucket;
+        MyIntrusiveList<Entry, LruTag> lru;
+
+        bucket.push_back(e1);
+        bucket.push_back(e2);
+        bucket.push_back(e3);
+        lru.push_front(e1);
+        lru.push_front(e2);
+        lru.push_front(e3); // lru: 3 2 1
+
+        // 访问 1：挪到 LRU 链的头部，桶链不受影响
+        lru.remove(e1);
+        lru.push_front(e1);
+        assert(lru.front().key == 1 && lru.back().key == 2);
+        assert(bucket.front().key == 1 && bucket.back().key == 3);
+
+        // 淘汰 LRU 尾部，同时从桶链中摘掉
+        Entry& victim = lru.back();
+        lru.pop_back();
+        bucket.remove(victim);
+        assert(victim.key == 2);
+        assert(bucket.size() == 2 && lru.size() == 2);
+    }
+
+    void test_splice_and_dispose() {
+        MyIntrusiveList<Item> a;
+        MyIntrusiveList<Item> b;
+        for (int i = 0; i < 4; ++i) a.push_back(*new Item(i));
+
+        b.splice(b.end(), a, a.begin());
+        auto second = a.begin();
+        ++second;
+        b.splice(b.begin(), a, second);
+        assert((values(a) == std::vector<int>{1, 3}));
+        assert((values(b) == std::vector<int>{2, 0}));
+
+        // 移动构造接管整条链
+        MyIntrusiveList<Item> c(std::move(b));
+        assert(b.empty() && c.size() == 2);
+
+        // clear_and_dispose 负责释放 new 出来的对象
+        int disposed = 0;
+        auto disposer = [&disposed](Item& item) { ++disposed; delete &item; };
+        a.clear_and_dispose(disposer);
+        c.clear_and_dispose(disposer);
+        assert(disposed == 4 && a.empty() && c.empty());
+
+        // 拷贝一个已在链表中的对象：副本不在任何链表里
+        Item original(9);
+        MyIntrusiveList<Item> list;
+        list.push_back(original);
+        Item copy = original;
+        list.push_back(copy);
+        assert(list.size() == 2 && (values(list) == std::vector<int>{9, 9}));
+        list.clear();
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> myintrusivelist_test_cases = {
+        {"Push / Pop / Iterate Test", test_push_pop_and_iterate},
+        {"Insert / Erase / Remove Test", test_insert_erase_remove},
+        {"Multiple Hooks Test", test_multiple_hooks},
+        {"Splice and Dispose Test", test_splice_and_dispose}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return myintrusivelist_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyIntrusiveList Tests");
+        for (const auto& test_case : myintrusivelist_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyIntrusiveList Tests Complete");
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef TEST_MYINTRUSIVELIST_H
+#define TEST_MYINTRUSIVELIST_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyIntrusiveList {
+    void test_push_pop_and_iterate();
+    void test_insert_erase_remove();
+    void test_multiple_hooks();
+    void test_splice_and_dispose();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
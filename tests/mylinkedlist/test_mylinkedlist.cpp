@@ -1,7 +1,18 @@
 #include "mylinkedlist/test_mylinkedlist.h"
 #include "common/test_common.h"
 #include "MyLinkedList.h"
+#include "MyNodePool.h"
+#include "MyVector.h"
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <unistd.h>   // sysconf
 #include <vector>
 
 namespace TestMyLinkedList {
@@ -144,6 +155,323 @@ namespace TestMyLinkedList {
         assert(list3.front() == 20);
     }
 
+    void test_splice_single() {
+        MyLinkedList<int> a;
+        MyLinkedList<int> b;
+        for (int i = 1; i <= 3; ++i) a.push_back(i);   // a: 1 2 3
+        b.push_back(10);                                // b: 10
+
+        // 把 a 的第二个元素挂到 b 的末尾，元素的地址保持不变
+        auto it = a.begin();
+        ++it;
+        int* addr = &(*it);
+        b.splice(b.end(), a, it);
+        assert(a.size() == 2 && a.front() == 1 && a.back() == 3);
+        assert(b.size() == 2 && b.back() == 2);
+        assert(&b.back() == addr);
+
+        // 挂到 b 的开头
+        b.splice(b.begin(), a, a.begin());
+        assert(b.front() == 1 && b.size() == 3);
+        assert(a.size() == 1 && a.front() == 3 && a.back() == 3);
+
+        // 最后一个元素也剪走，a 变为空链表
+        b.splice(b.end(), a, a.begin());
+        assert(a.empty() && a.begin() == a.end());
+
+        std::vector<int> order;
+        for (auto v = b.begin(); v != b.end(); ++v) order.push_back(*v);
+        assert((order == std::vector<int>{1, 10, 2, 3}));
+
+        // 同一个链表内部移动：把尾元素挪到头部
+        auto last = b.begin();
+        for (int i = 0; i < 3; ++i) ++last;
+        b.splice(b.begin(), b, last);
+        assert(b.front() == 3 && b.back() == 2 && b.size() == 4);
+    }
+
+    template <typename T, typename A>
+    static std::vector<T> to_vector(MyLinkedList<T, A>& list) {
+        std::vector<T> out;
+        for (auto it = list.begin(); it != list.end(); ++it) out.push_back(*it);
+        return out;
+    }
+
+    // 每个链表的 prev 指针必须和 next 指针一致
+    template <typename T, typename A>
+    static void check_backward(MyLinkedList<T, A>& list) {
+        std::vector<T> forward = to_vector(list);
+        std::vector<T> backward;
+        if (!list.empty()) {
+            auto it = list.begin();
+            for (size_t i = 1; i < list.size(); ++i) ++it;
+            assert(*it == list.back());
+            for (size_t i = 0; i < list.size(); ++i, --it) backward.push_back(*it);
+        }
+        std::reverse(backward.begin(), backward.end());
+        assert(forward == backward);
+        assert(forward.size() == list.size());
+    }
+
+    void test_insert_and_splice_range() {
+        MyLinkedList<int> list;
+        auto first = list.insert(list.end(), 2);   // [2]
+        list.insert(first, 1);                     // [1 2]
+        list.insert(list.end(), 4);                // [1 2 4]
+        auto it = list.begin();
+        ++it;
+        ++it;
+        auto three = list.insert(it, 3);           // [1 2 3 4]
+        assert(*three == 3);
+        assert((to_vector(list) == std::vector<int>{1, 2, 3, 4}));
+        check_backward(list);
+
+        // 整个链表
+        MyLinkedList<int> other;
+        for (int i = 10; i < 13; ++i) other.push_back(i);
+        int* addr = &other.front();
+        list.splice(three, other);                 // [1 2 10 11 12 3 4]
+        assert(other.empty() && other.begin() == other.end());
+        assert((to_vector(list) == std::vector<int>{1, 2, 10, 11, 12, 3, 4}));
+        assert(list.size() == 7 && addr == &(*++ ++list.begin()));
+        check_backward(list);
+
+        // 一段 [first, last)：把 10 11 12 挪到另一个链表的末尾
+        MyLinkedList<int> target;
+        target.push_back(0);
+        auto from = list.begin();
+        ++from;
+        ++from;
+        auto to = from;
+        ++to;
+        ++to;
+        ++to;
+        target.splice(target.end(), list, from, to);
+        assert((to_vector(target) == std::vector<int>{0, 10, 11, 12}));
+        assert((to_vector(list) == std::vector<int>{1, 2, 3, 4}));
+        assert(target.size() == 4 && list.size() == 4);
+        check_backward(target);
+        check_backward(list);
+
+        // 同一个链表内部：把前两个元素挪到末尾
+        auto second_end = list.begin();
+        ++second_end;
+        ++second_end;
+        list.splice(list.end(), list, list.begin(), second_end);
+        assert((to_vector(list) == std::vector<int>{3, 4, 1, 2}));
+        assert(list.size() == 4);
+        check_backward(list);
+    }
+
+    void test_merge_sort_unique_reverse() {
+        // merge
+        MyLinkedList<int> a;
+        MyLinkedList<int> b;
+        for (int v : {1, 4, 6, 9}) a.push_back(v);
+        for (int v : {2, 4, 5, 10, 11}) b.push_back(v);
+        a.merge(b);
+        assert(b.empty());
+        assert((to_vector(a) == std::vector<int>{1, 2, 4, 4, 5, 6, 9, 10, 11}));
+        check_backward(a);
+
+        // unique
+        assert(a.unique() == 1);
+        assert((to_vector(a) == std::vector<int>{1, 2, 4, 5, 6, 9, 10, 11}));
+        assert(a.unique([](int x, int y) { return y - x == 1; }) == 3); // 删掉 2、5、10
+        assert((to_vector(a) == std::vector<int>{1, 4, 6, 9, 11}));
+        check_backward(a);
+
+        // reverse
+        a.reverse();
+        assert((to_vector(a) == std::vector<int>{11, 9, 6, 4, 1}));
+        assert(a.front() == 11 && a.back() == 1);
+        check_backward(a);
+
+        // sort：与 std::stable_sort 对比，并检查稳定性
+        MyLinkedList<std::pair<int, int>> pairs;
+        std::vector<std::pair<int, int>> expected;
+        std::mt19937 gen(5);
+        for (int i = 0; i < 1000; ++i) {
+            std::pair<int, int> p(static_cast<int>(gen() % 50), i);
+            pairs.push_back(p);
+            expected.push_back(p);
+        }
+        std::pair<int, int>* first_addr = &pairs.front();
+        auto by_key = [](const std::pair<int, int>& x, const std::pair<int, int>& y) { return x.first < y.first; };
+        pairs.sort(by_key);
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        assert(to_vector(pairs) == expected);
+        check_backward(pairs);
+
+        // 节点没有被拷贝：原来第一个元素的地址依然指向同一个元素
+        bool still_there = false;
+        for (auto it = pairs.begin(); it != pairs.end(); ++it) {
+            if (&(*it) == first_addr) still_there = true;
+        }
+        assert(still_there);
+
+        // 降序、空链表、单元素
+        MyLinkedList<int> desc;
+        for (int v : {3, 1, 2}) desc.push_back(v);
+        desc.sort([](int x, int y) { return x > y; });
+        assert((to_vector(desc) == std::vector<int>{3, 2, 1}));
+        MyLinkedList<int> empty;
+        empty.sort();
+        empty.reverse();
+        assert(empty.unique() == 0 && empty.empty());
+        MyLinkedList<int> single;
+        single.push_back(7);
+        single.sort();
+        assert(single.front() == 7 && single.back() == 7);
+    }
+
+    // 链表原地归并排序 vs 拷贝进 MyVector 排序再写回
+    void test_sort_benchmark() {
+        const int N = 300000;
+        std::mt19937 gen(42);
+        MyLinkedList<int> list_a;
+        MyLinkedList<int> list_b;
+        for (int i = 0; i < N; ++i) {
+            int v = static_cast<int>(gen());
+            list_a.push_back(v);
+            list_b.push_back(v);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        list_a.sort();
+        auto t1 = std::chrono::steady_clock::now();
+
+        MyVector<int> buffer;
+        buffer.reserve(N);
+        for (auto it = list_b.begin(); it != list_b.end(); ++it) buffer.push_back(*it);
+        std::sort(&buffer[0], &buffer[0] + buffer.size());
+        size_t i = 0;
+        for (auto it = list_b.begin(); it != list_b.end(); ++it) *it = buffer[i++];
+        auto t2 = std::chrono::steady_clock::now();
+
+        assert(to_vector(list_a) == to_vector(list_b));
+        std::cout << "MyLinkedList::sort (relink)        : "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        std::cout << "copy to MyVector + std::sort + back: "
+                  << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+    }
+
+    void test_fixed_pool() {
+        MyFixedPool pool(24, 8);
+        assert(pool.chunk_size() == 24);
+        assert(pool.slab_count() == 0);
+
+        void* a = pool.allocate();
+        void* b = pool.allocate();
+        assert(a != b);
+        assert(reinterpret_cast<uintptr_t>(a) % 8 == 0);
+        assert(pool.slab_count() == 1 && pool.in_use() == 2);
+
+        // 释放的块会被马上复用 (后进先出)
+        pool.deallocate(a);
+        assert(pool.allocate() == a);
+
+        // 反复分配释放同一批块，不会再申请新的 slab
+        std::vector<void*> chunks;
+        for (int round = 0; round < 100; ++round) {
+            for (int i = 0; i < 1000; ++i) chunks.push_back(pool.allocate());
+            for (void* c : chunks) pool.deallocate(c);
+            chunks.clear();
+        }
+        size_t slabs = pool.slab_count();
+        for (int i = 0; i < 1000; ++i) chunks.push_back(pool.allocate());
+        assert(pool.slab_count() == slabs);
+        for (void* c : chunks) pool.deallocate(c);
+    }
+
+    void test_pool_allocator_list() {
+        using PoolList = MyLinkedList<std::string, MyPoolAllocator<std::string>>;
+        PoolList list;
+        for (int i = 0; i < 1000; ++i) list.push_back("item-" + std::to_string(i));
+        list.push_front("head");
+        assert(list.size() == 1001);
+        assert(list.front() == "head" && list.back() == "item-999");
+
+        // 拷贝、赋值、splice 都与默认分配器的行为一致
+        PoolList copy = list;
+        assert(copy.size() == 1001 && copy.back() == "item-999");
+        PoolList other;
+        other.splice(other.end(), list, list.begin());
+        assert(other.front() == "head" && list.front() == "item-0");
+
+        while (!list.empty()) list.pop_back();
+        copy = other;
+        assert(copy.size() == 1 && copy.front() == "head");
+
+        // 不带线程缓存的版本
+        MyLinkedList<int, MyPoolAllocator<int, false>> shared;
+        for (int i = 0; i < 100; ++i) shared.push_back(i);
+        auto it = shared.begin();
+        ++it;
+        shared.erase(it);
+        assert(shared.size() == 99 && shared.front() == 0);
+    }
+
+    // 生产者线程分配节点，消费者线程释放节点，块在线程缓存之间流动
+    void test_pool_allocator_cross_thread() {
+        using PoolList = MyLinkedList<int, MyPoolAllocator<int>>;
+        const int rounds = 50;
+        const int per_round = 2000;
+        long long sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            PoolList* batch = new PoolList();
+            std::thread producer([batch] {
+                for (int i = 0; i < per_round; ++i) batch->push_back(i);
+            });
+            producer.join();
+            std::thread consumer([batch, &sum] {
+                while (!batch->empty()) {
+                    sum += batch->front();
+                    batch->pop_front();
+                }
+                delete batch;
+            });
+            consumer.join();
+        }
+        assert(sum == static_cast<long long>(rounds) * per_round * (per_round - 1) / 2);
+    }
+
+    // 当前进程的常驻内存 (RSS)，单位 KB；非 Linux 平台返回 0
+    static long current_rss_kb() {
+        std::ifstream statm("/proc/self/statm");
+        long pages = 0, resident = 0;
+        if (!(statm >> pages >> resident)) return 0;
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+
+    // 队列式的节点进出：new/delete vs 节点池
+    void test_node_churn_benchmark() {
+        const int LIVE = 10000;       // 链表中始终保持的元素数
+        const int OPS = 2000000;      // push_back + pop_front 的次数
+
+        auto run = [&](const char* label, auto& list) {
+            long rss_before = current_rss_kb();
+            for (int i = 0; i < LIVE; ++i) list.push_back(i);
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < OPS; ++i) {
+                list.push_back(i);
+                list.pop_front();
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            double secs = std::chrono::duration<double>(t1 - t0).count();
+            long rss_after = current_rss_kb();
+            assert(list.size() == static_cast<size_t>(LIVE));
+            std::cout << label << ": " << (OPS / secs / 1e6) << " M push+pop/s, RSS +"
+                      << (rss_after - rss_before) << " KB" << std::endl;
+        };
+
+        MyLinkedList<int> plain;
+        MyLinkedList<int, MyPoolAllocator<int>> pooled;
+        MyLinkedList<int, MyPoolAllocator<int, false>> locked;
+        run("std::allocator (new/delete)   ", plain);
+        run("MyPoolAllocator (thread cache)", pooled);
+        run("MyPoolAllocator (shared only) ", locked);
+    }
 
     // 创建测试用例注册表
     static const std::vector<TestCase> mylinkedlist_test_cases = {
@@ -153,7 +481,15 @@ namespace TestMyLinkedList {
         {"Access and Pop Test", test_access_and_pop},
         {"Iterator Test", test_iterator},
         {"Reverse Iterator Test", test_reverse_iterator},
-        {"Copy Semantics Test", test_copy_semantics}
+        {"Copy Semantics Test", test_copy_semantics},
+        {"Splice Test", test_splice_single},
+        {"Insert and Splice Range Test", test_insert_and_splice_range},
+        {"Merge / Sort / Unique / Reverse Test", test_merge_sort_unique_reverse},
+        {"Sort Benchmark", test_sort_benchmark},
+        {"Fixed Pool Test", test_fixed_pool},
+        {"Pool Allocator List Test", test_pool_allocator_list},
+        {"Pool Allocator Cross-thread Test", test_pool_allocator_cross_thread},
+        {"Node Churn Benchmark", test_node_churn_benchmark}
     };
 
     // 获取测试用例列表
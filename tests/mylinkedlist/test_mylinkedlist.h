@@ -12,6 +12,14 @@ namespace TestMyLinkedList {
     void test_iterator();
     void test_reverse_iterator();
     void test_copy_semantics();
+    void test_splice_single();
+    void test_insert_and_splice_range();
+    void test_merge_sort_unique_reverse();
+    void test_sort_benchmark();
+    void test_fixed_pool();
+    void test_pool_allocator_list();
+    void test_pool_allocator_cross_thread();
+    void test_node_churn_benchmark();
 
     // 获取测试用例列表
     const std::vector<TestCase>& get_test_cases();
@@ -0,0 +1,232 @@
+#include "mylrucache/test_mylrucache.h"
+#include "common/test_common.h"
+#include "MyLRUCache.h"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace TestMyLRUCache {
+
+    void test_lru_eviction_order() {
+        MyLRUCache<int, std::string> cache(3);
+        assert(cache.put(1, "one"));
+        assert(cache.put(2, "two"));
+        assert(cache.put(3, "three"));
+        assert(cache.size() == 3);
+
+        // 访问 1，使 2 成为最久未使用的
+        assert(*cache.get(1) == "one");
+        cache.put(4, "four");
+        assert(cache.size() == 3);
+        assert(!cache.contains(2));
+        assert(cache.contains(1) && cache.contains(3) && cache.contains(4));
+
+        // peek 不改变顺序：3 依然是最旧的
+        assert(*cache.peek(3) == "three");
+        cache.put(5, "five");
+        assert(!cache.contains(3));
+        assert(cache.get(3) == nullptr);
+    }
+
+    void test_update_and_erase() {
+        MyLRUCache<std::string, int> cache(2);
+        cache.put("a", 1);
+        cache.put("b", 2);
+        assert(!cache.put("a", 10)); // 更新已有的 key，同时标记为最近使用
+        cache.put("c", 3);           // 淘汰 b
+        assert(*cache.get("a") == 10);
+        assert(!cache.contains("b"));
+
+        assert(cache.erase("a"));
+        assert(!cache.erase("a"));
+        assert(cache.size() == 1 && cache.weight() == 1);
+        cache.put("d", 4);
+        cache.put("e", 5);           // 淘汰 c
+        assert(!cache.contains("c") && cache.contains("d") && cache.contains("e"));
+
+        cache.clear();
+        assert(cache.empty() && cache.weight() == 0);
+        cache.put("x", 1);
+        assert(*cache.get("x") == 1);
+
+        // 容量缩小时立刻淘汰
+        cache.put("y", 2);
+        cache.set_capacity(1);
+        assert(cache.size() == 1 && cache.contains("y"));
+    }
+
+    void test_eviction_callback_and_stats() {
+        MyLRUCache<int, int> cache(2);
+        std::vector<std::pair<int, int>> evicted;
+        cache.set_eviction_callback([&evicted](const int& k, const int& v) { evicted.push_back({k, v}); });
+
+        cache.put(1, 100);
+        cache.put(2, 200);
+        cache.get(1);
+        cache.get(7);               // miss
+        cache.put(3, 300);          // 淘汰 2
+        cache.put(4, 400);          // 淘汰 1
+        cache.erase(3);             // 主动删除不算淘汰
+
+        assert(evicted.size() == 2);
+        assert(evicted[0].first == 2 && evicted[0].second == 200);
+        assert(evicted[1].first == 1 && evicted[1].second == 100);
+        assert(cache.hits() == 1 && cache.misses() == 1 && cache.evictions() == 2);
+        assert(cache.hit_rate() == 0.5);
+
+        cache.reset_stats();
+        assert(cache.hits() == 0 && cache.evictions() == 0 && cache.hit_rate() == 0.0);
+    }
+
+    void test_weighted_capacity() {
+        // 按字节计算：key 长度 + value 长度
+        MyLRUCache<std::string, std::string> cache(20);
+        cache.set_weigher([](const std::string& k, const std::string& v) { return k.size() + v.size(); });
+
+        cache.put("a", "123456789");   // 10
+        cache.put("b", "123456789");   // 20
+        assert(cache.weight() == 20 && cache.size() == 2);
+        cache.put("c", "1234");        // 25 -> 淘汰 a
+        assert(!cache.contains("a") && cache.weight() == 15);
+
+        // 更新为更大的 value，也会触发淘汰
+        cache.put("c", "12345678901234");  // b(10) + c(15) = 25 -> 淘汰 b
+        assert(!cache.contains("b") && cache.weight() == 15);
+
+        // 单个条目超过总容量：直接拒绝，其他条目不受影响，也不触发淘汰回调
+        int evicted = 0;
+        cache.set_eviction_callback([&](const std::string&, const std::string&) { evicted++; });
+        size_t evictions = cache.evictions();
+        assert(!cache.put("huge", std::string(100, 'x')));
+        assert(!cache.contains("huge") && cache.contains("c"));
+        assert(cache.size() == 1 && cache.weight() == 15);
+        assert(evicted == 0 && cache.evictions() == evictions);
+
+        // 已有的 key 更新成超过总容量的 value：只删掉这个 key 自己 (不能留着旧值)，其他条目保留
+        cache.put("d", "1");           // c(15) + d(2) = 17
+        assert(!cache.put("d", std::string(100, 'x')));
+        assert(!cache.contains("d") && cache.contains("c"));
+        assert(cache.size() == 1 && cache.weight() == 15 && evicted == 0);
+
+        // SegmentedLRU 下保护段里的条目也一样
+        MyLRUCache<std::string, std::string> slru(20, MyCachePolicy::SegmentedLRU);
+        slru.set_weigher([](const std::string& k, const std::string& v) { return k.size() + v.size(); });
+        slru.put("p", "1234");
+        slru.get("p");                 // 升入保护段
+        slru.put("q", "1234");
+        assert(!slru.put("p", std::string(100, 'x')));
+        assert(!slru.contains("p") && slru.contains("q") && slru.weight() == 5);
+        slru.put("p", "12");           // 保护段的权重也要跟着清掉，重新插入后一切正常
+        slru.get("p");
+        assert(slru.size() == 2 && slru.weight() == 8);
+    }
+
+    void test_segmented_lru_scan_resistance() {
+        const int HOT = 40;
+        auto run = [&](MyCachePolicy policy) {
+            MyLRUCache<int, int> cache(50, policy);
+            // 热点 key 访问两次，进入 SLRU 的保护段
+            for (int round = 0; round < 2; ++round) {
+                for (int k = 0; k < HOT; ++k) {
+                    if (!cache.get(k)) cache.put(k, k);
+                }
+            }
+            // 一次性扫描 1000 个冷 key
+            for (int k = 1000; k < 2000; ++k) {
+                if (!cache.get(k)) cache.put(k, k);
+            }
+            int survivors = 0;
+            for (int k = 0; k < HOT; ++k) survivors += cache.contains(k);
+            assert(cache.size() <= 50);
+            return survivors;
+        };
+        int lru_survivors = run(MyCachePolicy::LRU);
+        int slru_survivors = run(MyCachePolicy::SegmentedLRU);
+        assert(lru_survivors == 0);                 // 扫描把热点全部冲掉
+        assert(slru_survivors == HOT);              // 保护段 (40 个) 完整保留
+    }
+
+    // Zipf 分布的 key 生成器：预先算好累积分布，然后二分查找
+    class ZipfGenerator {
+    public:
+        ZipfGenerator(size_t n, double alpha, unsigned seed) : _cdf(n), _gen(seed), _dist(0.0, 1.0) {
+            double sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += 1.0 / std::pow(static_cast<double>(i + 1), alpha);
+                _cdf[i] = sum;
+            }
+            for (auto& c : _cdf) c /= sum;
+        }
+        int next() {
+            double u = _dist(_gen);
+            size_t lo = 0, hi = _cdf.size() - 1;
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                if (_cdf[mid] < u) lo = mid + 1;
+                else hi = mid;
+            }
+            // 打乱排名与 key 的对应关系，热点不全挤在小整数上
+            return static_cast<int>((lo * 2654435761u) % 1000003u);
+        }
+    private:
+        std::vector<double> _cdf;
+        std::mt19937 _gen;
+        std::uniform_real_distribution<double> _dist;
+    };
+
+    // 用 Zipf 访问序列回放：未命中时 put，统计命中率和吞吐
+    void test_zipf_replay_benchmark() {
+        const size_t KEYS = 100000;
+        const int REQUESTS = 1000000;
+        for (double alpha : {0.8, 1.0, 1.2}) {
+            ZipfGenerator zipf(KEYS, alpha, 123);
+            std::vector<int> trace(REQUESTS);
+            for (auto& k : trace) k = zipf.next();
+
+            for (size_t capacity : {KEYS / 100, KEYS / 10}) {
+                for (MyCachePolicy policy : {MyCachePolicy::LRU, MyCachePolicy::SegmentedLRU}) {
+                    MyLRUCache<int, int> cache(capacity, policy);
+                    auto t0 = std::chrono::steady_clock::now();
+                    for (int key : trace) {
+                        if (cache.get(key) == nullptr) cache.put(key, key);
+                    }
+                    auto t1 = std::chrono::steady_clock::now();
+                    double secs = std::chrono::duration<double>(t1 - t0).count();
+                    assert(cache.size() <= capacity);
+                    assert(cache.hits() + cache.misses() == static_cast<size_t>(REQUESTS));
+                    std::cout << "alpha=" << alpha << " capacity=" << capacity
+                              << (policy == MyCachePolicy::LRU ? " LRU : " : " SLRU: ")
+                              << "hit rate " << cache.hit_rate() * 100 << "%, "
+                              << REQUESTS / secs / 1e6 << " M req/s" << std::endl;
+                }
+            }
+        }
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> mylrucache_test_cases = {
+        {"LRU Eviction Order Test", test_lru_eviction_order},
+        {"Update and Erase Test", test_update_and_erase},
+        {"Eviction Callback and Stats Test", test_eviction_callback_and_stats},
+        {"Weighted Capacity Test", test_weighted_capacity},
+        {"Segmented LRU Scan Resistance Test", test_segmented_lru_scan_resistance},
+        {"Zipf Replay Benchmark", test_zipf_replay_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return mylrucache_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyLRUCache Tests");
+        for (const auto& test_case : mylrucache_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyLRUCache Tests Complete");
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef TEST_MYLRUCACHE_H
+#define TEST_MYLRUCACHE_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyLRUCache {
+    void test_lru_eviction_order();
+    void test_update_and_erase();
+    void test_eviction_callback_and_stats();
+    void test_weighted_capacity();
+    void test_segmented_lru_scan_resistance();
+    void test_zipf_replay_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
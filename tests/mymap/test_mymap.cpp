@@ -1,7 +1,10 @@
 #include "test_mymap.h"
 
+#include <chrono>
+#include <random>
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include "common/test_common.h"
 #include "MyMap.h"
 
@@ -136,13 +139,159 @@ namespace TestMyMap {
         std::cout << "Erase and Remove Test Passed." << std::endl;
     }
 
+    void test_avl_engine() {
+        // 以时间戳为键的典型场景：键单调递增
+        MyMapPro<long long, int, MyAVLTree> m;
+        const long long base = 1700000000000LL;
+        const int N = 100000;
+        for (int i = 0; i < N; ++i) m.insert(base + i, i);
+        m[base + N] = N;
+        if (m.size() != N + 1) throw std::runtime_error("AVL engine test failed: size should be N + 1.");
+        int* value = m.find(base + 12345);
+        if (value == nullptr || *value != 12345) throw std::runtime_error("AVL engine test failed: wrong value for key.");
+
+        for (int i = 0; i < N; ++i) m.erase(base + i);
+        if (m.size() != 1 || m.find(base + N) == nullptr) {
+            throw std::runtime_error("AVL engine test failed: only the last key should remain.");
+        }
+        std::cout << "AVL Engine Test Passed." << std::endl;
+    }
+
+    void test_order_statistics() {
+        // 排行榜：按分数 (key) 排序
+        MyMapPro<int, std::string> board;
+        board.insert(300, "carol");
+        board.insert(100, "alice");
+        board.insert(500, "erin");
+        board.insert(200, "bob");
+        board.insert(400, "dave");
+
+        const auto* lowest = board.select(0);
+        const auto* highest = board.select(board.size() - 1);
+        if (lowest == nullptr || lowest->key != 100 || lowest->value != "alice" ||
+            highest == nullptr || highest->key != 500 || highest->value != "erin") {
+            throw std::runtime_error("Order statistics test failed: select returned the wrong pair.");
+        }
+        if (board.select(5) != nullptr) throw std::runtime_error("Order statistics test failed: select past the end should be null.");
+        if (board.rank(300) != 2 || board.rank(250) != 2 || board.rank(1000) != 5) {
+            throw std::runtime_error("Order statistics test failed: rank is incorrect.");
+        }
+        if (board.count_in_range(200, 400) != 2 || board.count_in_range(0, 1000) != 5) {
+            throw std::runtime_error("Order statistics test failed: count_in_range is incorrect.");
+        }
+        std::cout << "Order Statistics Test Passed." << std::endl;
+    }
+
+    void test_range_queries() {
+        // 以时间戳为键的事件日志，查询一个时间窗口
+        MyMapPro<int, std::string, MyAVLTree> events;
+        for (int t = 1000; t < 2000; t += 10) events.insert(t, "event@" + std::to_string(t));
+
+        std::vector<int> keys;
+        for (const auto& entry : events.range(1095, 1130)) {
+            keys.push_back(entry.key);
+            if (entry.value != "event@" + std::to_string(entry.key)) throw std::runtime_error("Range test failed: value does not match key.");
+        }
+        if (keys != std::vector<int>{1100, 1110, 1120}) throw std::runtime_error("Range test failed: wrong keys in [1095, 1130).");
+
+        int visited = 0;
+        events.for_each_in_range(1500, 1600, [&](const auto& entry) {
+            visited++;
+            return entry.key < 1520; // 看到 1520 就停
+        });
+        if (visited != 3) throw std::runtime_error("Range test failed: early termination did not stop the scan.");
+
+        if (!events.range(2000, 3000).empty()) throw std::runtime_error("Range test failed: range past the last key should be empty.");
+        std::cout << "Range Queries Test Passed." << std::endl;
+    }
+
+    static volatile long long g_sink = 0;
+
+    void test_range_scan_benchmark() {
+        // 需求里是 1000 万条；默认构建没开优化，这里缩小到 100 万条，窗口大小 16
+        const int N = 1000000;
+        const int WINDOW = 16;
+        MyMapPro<long long, int, MyAVLTree> m;
+        MyAVLTree<Pair<long long, int>> whole_tree; // 对照组：只能 inorder 整棵树再过滤
+        for (int i = 0; i < N; ++i) {
+            m.insert(i, i);
+            whole_tree.insert(Pair<long long, int>(i, i));
+        }
+
+        using Clock = std::chrono::steady_clock;
+        std::mt19937 rng(13);
+
+        const int SCANS = 3;
+        auto t0 = Clock::now();
+        for (int q = 0; q < SCANS; ++q) {
+            long long lo = rng() % (N - WINDOW);
+            long long sum = 0;
+            whole_tree.inorder([&](const Pair<long long, int>& entry) {
+                if (entry.key >= lo && entry.key < lo + WINDOW) sum += entry.value;
+            });
+            if (sum != WINDOW * lo + WINDOW * (WINDOW - 1) / 2) throw std::runtime_error("Range benchmark: wrong sum from full scan.");
+            g_sink = sum;
+        }
+        double scan_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / SCANS;
+
+        const int QUERIES = 100000;
+        t0 = Clock::now();
+        for (int q = 0; q < QUERIES; ++q) {
+            long long lo = rng() % (N - WINDOW);
+            long long sum = 0;
+            m.for_each_in_range(lo, lo + WINDOW, [&](const Pair<long long, int>& entry) { sum += entry.value; });
+            if (sum != WINDOW * lo + WINDOW * (WINDOW - 1) / 2) throw std::runtime_error("Range benchmark: wrong sum from for_each_in_range.");
+            g_sink = sum;
+        }
+        double visit_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / QUERIES;
+
+        t0 = Clock::now();
+        for (int q = 0; q < QUERIES; ++q) {
+            long long lo = rng() % (N - WINDOW);
+            long long sum = 0;
+            for (const auto& entry : m.range(lo, lo + WINDOW)) sum += entry.value;
+            g_sink = sum;
+        }
+        double range_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / QUERIES;
+
+        std::cout << "n = " << N << ", window = " << WINDOW << ": inorder + filter " << scan_us
+                  << " us/query, for_each_in_range " << visit_us << " us/query, range() " << range_us
+                  << " us/query" << std::endl;
+    }
+
+    void test_build_from_sorted() {
+        std::vector<Pair<int, std::string>> snapshot;
+        for (int i = 0; i < 1000; ++i) snapshot.emplace_back(i * 10, "v" + std::to_string(i));
+        snapshot.emplace_back(9990, "duplicate"); // key 相同的相邻元素只保留第一个
+
+        MyMapPro<int, std::string, MyAVLTree> m;
+        m[-1] = "gone";
+        m.build_from_sorted(snapshot.begin(), snapshot.end());
+        if (m.size() != 1000 || m.find(-1) != nullptr) {
+            throw std::runtime_error("Build from sorted test failed: wrong size after bulk load.");
+        }
+        std::string* value = m.find(9990);
+        if (value == nullptr || *value != "v999") throw std::runtime_error("Build from sorted test failed: wrong value.");
+        if (m.select(500)->key != 5000 || m.rank(5000) != 500) {
+            throw std::runtime_error("Build from sorted test failed: order statistics are wrong after bulk load.");
+        }
+        m[5] = "new";
+        if (m.size() != 1001 || *m.find(5) != "new") throw std::runtime_error("Build from sorted test failed: insert after bulk load.");
+        std::cout << "Build From Sorted Test Passed." << std::endl;
+    }
+
     // 在 mymap_test_cases 中注册
     static const std::vector<TestCase> mymap_test_cases = {
         {"Insert and Find", test_insert_and_find},
         {"Operator Square Brackets", test_operator_square_brackets},
         {"Overwrite and Duplicates", test_overwrite_and_duplicates},
         {"Size, Empty, Clear", test_size_empty_clear},
-        {"Erase and Remove", test_erase_and_remove}
+        {"Erase and Remove", test_erase_and_remove},
+        {"AVL Engine", test_avl_engine},
+        {"Order Statistics", test_order_statistics},
+        {"Range Queries", test_range_queries},
+        {"Range Scan Benchmark", test_range_scan_benchmark},
+        {"Build From Sorted", test_build_from_sorted}
     };
 
 
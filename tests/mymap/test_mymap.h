@@ -11,6 +11,11 @@ namespace TestMyMap {
     void test_overwrite_and_duplicates();
     void test_size_empty_clear();
     void test_erase_and_remove();
+    void test_avl_engine();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_range_scan_benchmark();
+    void test_build_from_sorted();
 
     // --- 声明管理函数 ---
     const std::vector<TestCase>& get_test_cases();
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include "common/test_common.h"
 #include "MyMapPro.h"
 
@@ -136,13 +137,85 @@ namespace TestMyMapPro {
         std::cout << "Erase and Remove Test Passed." << std::endl;
     }
 
+    void test_order_statistics() {
+        // 排行榜：按分数 (key) 排序
+        MyMapPro<int, std::string> board;
+        board.insert(300, "carol");
+        board.insert(100, "alice");
+        board.insert(500, "erin");
+        board.insert(200, "bob");
+        board.insert(400, "dave");
+
+        const auto* lowest = board.select(0);
+        const auto* highest = board.select(board.size() - 1);
+        if (lowest == nullptr || lowest->key != 100 || lowest->value != "alice" ||
+            highest == nullptr || highest->key != 500 || highest->value != "erin") {
+            throw std::runtime_error("Order statistics test failed: select returned the wrong pair.");
+        }
+        if (board.select(5) != nullptr) throw std::runtime_error("Order statistics test failed: select past the end should be null.");
+        if (board.rank(300) != 2 || board.rank(250) != 2 || board.rank(1000) != 5) {
+            throw std::runtime_error("Order statistics test failed: rank is incorrect.");
+        }
+        if (board.count_in_range(200, 400) != 2 || board.count_in_range(0, 1000) != 5) {
+            throw std::runtime_error("Order statistics test failed: count_in_range is incorrect.");
+        }
+        std::cout << "Order Statistics Test Passed." << std::endl;
+    }
+
+    void test_range_queries() {
+        // 以时间戳为键的事件日志，查询一个时间窗口
+        MyMapPro<int, std::string> events;
+        for (int t = 1000; t < 2000; t += 10) events.insert(t, "event@" + std::to_string(t));
+
+        std::vector<int> keys;
+        for (const auto& entry : events.range(1095, 1130)) {
+            keys.push_back(entry.key);
+            if (entry.value != "event@" + std::to_string(entry.key)) throw std::runtime_error("Range test failed: value does not match key.");
+        }
+        if (keys != std::vector<int>{1100, 1110, 1120}) throw std::runtime_error("Range test failed: wrong keys in [1095, 1130).");
+
+        int visited = 0;
+        events.for_each_in_range(1500, 1600, [&](const auto& entry) {
+            visited++;
+            return entry.key < 1520; // 看到 1520 就停
+        });
+        if (visited != 3) throw std::runtime_error("Range test failed: early termination did not stop the scan.");
+
+        if (!events.range(2000, 3000).empty()) throw std::runtime_error("Range test failed: range past the last key should be empty.");
+        std::cout << "Range Queries Test Passed." << std::endl;
+    }
+
+    void test_build_from_sorted() {
+        std::vector<Pair<int, std::string>> snapshot;
+        for (int i = 0; i < 1000; ++i) snapshot.emplace_back(i * 10, "v" + std::to_string(i));
+        snapshot.emplace_back(9990, "duplicate"); // key 相同的相邻元素只保留第一个
+
+        MyMapPro<int, std::string> m;
+        m[-1] = "gone";
+        m.build_from_sorted(snapshot.begin(), snapshot.end());
+        if (m.size() != 1000 || m.find(-1) != nullptr) {
+            throw std::runtime_error("Build from sorted test failed: wrong size after bulk load.");
+        }
+        std::string* value = m.find(9990);
+        if (value == nullptr || *value != "v999") throw std::runtime_error("Build from sorted test failed: wrong value.");
+        if (m.select(500)->key != 5000 || m.rank(5000) != 500) {
+            throw std::runtime_error("Build from sorted test failed: order statistics are wrong after bulk load.");
+        }
+        m[5] = "new";
+        if (m.size() != 1001 || *m.find(5) != "new") throw std::runtime_error("Build from sorted test failed: insert after bulk load.");
+        std::cout << "Build From Sorted Test Passed." << std::endl;
+    }
+
     // 在 mymappro_test_cases 中注册
     static const std::vector<TestCase> mymappro_test_cases = {
         {"Insert and Find", test_insert_and_find},
         {"Operator Square Brackets", test_operator_square_brackets},
         {"Overwrite and Duplicates", test_overwrite_and_duplicates},
         {"Size, Empty, Clear", test_size_empty_clear},
-        {"Erase and Remove", test_erase_and_remove}
+        {"Erase and Remove", test_erase_and_remove},
+        {"Order Statistics", test_order_statistics},
+        {"Range Queries", test_range_queries},
+        {"Build From Sorted", test_build_from_sorted}
     };
 
 
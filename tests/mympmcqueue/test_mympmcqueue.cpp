@@ -0,0 +1,332 @@
+#include "mympmcqueue/test_mympmcqueue.h"
+#include "common/test_common.h"
+#include "MyMPMCQueue.h"
+#include "MyQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * 压力测试只通过队列本身在线程之间传递数据，结果在 join 之后才检查，
+ * 因此可以直接在 -fsanitize=thread 下运行，不会有测试代码自身的数据竞争。
+ */
+namespace TestMyMPMCQueue {
+    void test_basic_operations() {
+        MyMPMCQueue<int> q(6);
+        assert(q.capacity() == 8);
+        assert(q.empty_approx());
+
+        int out = -1;
+        assert(!q.try_pop(out));
+
+        for (int i = 0; i < 8; ++i) assert(q.try_push(i));
+        assert(!q.try_push(8));
+        assert(q.size_approx() == 8);
+
+        // 绕圈若干轮，FIFO 顺序不变
+        int next_in = 8, next_out = 0;
+        for (int round = 0; round < 100; ++round) {
+            assert(q.try_pop(out) && out == next_out++);
+            assert(q.try_push(next_in++));
+        }
+        while (q.try_pop(out)) assert(out == next_out++);
+        assert(next_out == next_in);
+    }
+
+    void test_bulk_operations() {
+        MyMPMCQueue<std::string> q(8);
+        std::vector<std::string> input;
+        for (int i = 0; i < 12; ++i) input.push_back(std::to_string(i));
+
+        assert(q.try_push_bulk(input.data(), 12) == 8);
+        assert(q.try_push_bulk(input.data(), 1) == 0);
+
+        std::string out[16];
+        assert(q.try_pop_bulk(out, 5) == 5);
+        for (int i = 0; i < 5; ++i) assert(out[i] == input[i]);
+
+        // 跨过数组末尾
+        assert(q.try_push_bulk(input.data() + 8, 4) == 4);
+        assert(q.try_pop_bulk(out, 16) == 7);
+        for (int i = 0; i < 7; ++i) assert(out[i] == input[5 + i]);
+        assert(q.try_pop_bulk(out, 16) == 0);
+
+        // 阻塞版本：push_bulk 会等到全部写完
+        q.push_bulk(input.data(), 3);
+        assert(q.pop_bulk(out, 16) == 3 && out[2] == "2");
+    }
+
+    void test_move_only() {
+        MyMPMCQueue<std::unique_ptr<int>> q(2);
+        assert(q.try_push(std::make_unique<int>(1)));
+        assert(q.try_push(std::make_unique<int>(2)));
+        auto third = std::make_unique<int>(3);
+        assert(!q.try_push(std::move(third)));
+        assert(third && *third == 3); // 失败时参数没有被移走
+
+        std::unique_ptr<int> out;
+        q.pop(out);
+        assert(*out == 1);
+        q.push(std::move(third));
+        q.pop(out);
+        assert(*out == 2);
+        q.pop(out);
+        assert(*out == 3);
+
+        // 析构时释放仍在队列里的元素
+        q.push(std::make_unique<int>(4));
+    }
+
+    // 值的编码：高 32 位是生产者编号，低 32 位是该生产者内的序号
+    static uint64_t encode(int producer, uint32_t seq) { return (static_cast<uint64_t>(producer) << 32) | seq; }
+
+    // producers 个线程各推送 per_producer 个值，consumers 个线程取出。检查：
+    //   1. 每个值恰好被取出一次；
+    //   2. 同一个消费者看到的、同一个生产者的值是按顺序的 (队列是 FIFO 的)。
+    template <typename Push, typename Pop>
+    static void run_stress(int producers, int consumers, uint32_t per_producer, Push push, Pop pop) {
+        const uint64_t total = static_cast<uint64_t>(producers) * per_producer;
+        std::atomic<uint64_t> consumed{0};
+        std::vector<std::vector<uint64_t>> received(consumers);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (uint32_t i = 0; i < per_producer; ++i) push(encode(p, i));
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&, c] {
+                std::vector<uint64_t>& mine = received[c];
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    if (pop(mine)) consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+
+        std::vector<uint32_t> seen(total, 0);
+        for (const auto& mine : received) {
+            std::vector<int64_t> last(producers, -1);
+            for (uint64_t value : mine) {
+                int p = static_cast<int>(value >> 32);
+                uint32_t seq = static_cast<uint32_t>(value);
+                assert(p < producers && seq < per_producer);
+                assert(static_cast<int64_t>(seq) > last[p]);
+                last[p] = seq;
+                seen[static_cast<uint64_t>(p) * per_producer + seq]++;
+            }
+        }
+        for (uint32_t count : seen) assert(count == 1);
+    }
+
+    void test_stress_exactly_once() {
+        const int shapes[][2] = {{1, 1}, {1, 4}, {4, 1}, {4, 4}, {8, 3}};
+        for (const auto& shape : shapes) {
+            MyMPMCQueue<uint64_t> q(16);
+            run_stress(shape[0], shape[1], 20000,
+                [&](uint64_t v) { while (!q.try_push(v)) std::this_thread::yield(); },
+                [&](std::vector<uint64_t>& out) {
+                    uint64_t v;
+                    if (!q.try_pop(v)) { std::this_thread::yield(); return false; }
+                    out.push_back(v);
+                    return true;
+                });
+            assert(q.empty_approx());
+        }
+    }
+
+    void test_stress_bulk() {
+        // 生产者一次推 5 个，消费者一次取最多 7 个；批量认领的槽位与单个操作混在一起
+        const int PRODUCERS = 4, CONSUMERS = 4;
+        const uint32_t PER_PRODUCER = 20000;
+        MyMPMCQueue<uint64_t> q(32);
+        std::atomic<uint64_t> consumed{0};
+        const uint64_t total = static_cast<uint64_t>(PRODUCERS) * PER_PRODUCER;
+        std::vector<std::vector<uint64_t>> received(CONSUMERS);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < PRODUCERS; ++p) {
+            threads.emplace_back([&, p] {
+                uint64_t batch[5];
+                for (uint32_t i = 0; i < PER_PRODUCER; i += 5) {
+                    for (uint32_t k = 0; k < 5; ++k) batch[k] = encode(p, i + k);
+                    if (p % 2 == 0) q.push_bulk(batch, 5);
+                    else for (uint64_t v : batch) q.push(v);
+                }
+            });
+        }
+        for (int c = 0; c < CONSUMERS; ++c) {
+            threads.emplace_back([&, c] {
+                uint64_t batch[7];
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    size_t n = q.try_pop_bulk(batch, c % 2 == 0 ? 7 : 1);
+                    if (n == 0) { std::this_thread::yield(); continue; }
+                    received[c].insert(received[c].end(), batch, batch + n);
+                    consumed.fetch_add(n, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+
+        std::vector<uint32_t> seen(total, 0);
+        for (const auto& mine : received) {
+            std::vector<int64_t> last(PRODUCERS, -1);
+            for (uint64_t value : mine) {
+                int p = static_cast<int>(value >> 32);
+                uint32_t seq = static_cast<uint32_t>(value);
+                assert(static_cast<int64_t>(seq) > last[p]);
+                last[p] = seq;
+                seen[static_cast<uint64_t>(p) * PER_PRODUCER + seq]++;
+            }
+        }
+        for (uint32_t count : seen) assert(count == 1);
+    }
+
+    void test_stress_blocking() {
+        // 小容量 + futex 等待：生产者和消费者都会频繁地睡下又被唤醒，不能丢失唤醒
+        for (MyWaitStrategy wait : {MyWaitStrategy::Spin, MyWaitStrategy::Block}) {
+            MyMPMCQueue<uint64_t> q(4, wait);
+            const int PRODUCERS = 3, CONSUMERS = 3;
+            const uint32_t PER_PRODUCER = 10000;
+            std::vector<std::vector<uint64_t>> received(CONSUMERS);
+            std::vector<std::thread> threads;
+            for (int p = 0; p < PRODUCERS; ++p) {
+                threads.emplace_back([&, p] {
+                    for (uint32_t i = 0; i < PER_PRODUCER; ++i) q.push(encode(p, i));
+                });
+            }
+            // 每个消费者取固定数量，全部用阻塞的 pop
+            for (int c = 0; c < CONSUMERS; ++c) {
+                threads.emplace_back([&, c] {
+                    uint64_t v;
+                    for (uint32_t i = 0; i < PER_PRODUCER; ++i) {
+                        q.pop(v);
+                        received[c].push_back(v);
+                    }
+                });
+            }
+            for (auto& t : threads) t.join();
+
+            std::vector<uint32_t> seen(static_cast<size_t>(PRODUCERS) * PER_PRODUCER, 0);
+            for (const auto& mine : received) {
+                for (uint64_t value : mine) {
+                    seen[(value >> 32) * PER_PRODUCER + static_cast<uint32_t>(value)]++;
+                }
+            }
+            for (uint32_t count : seen) assert(count == 1);
+            assert(q.empty_approx());
+        }
+    }
+
+    // 对照组：用一把互斥锁保护的有界 MyQueue
+    template <typename T>
+    class LockedQueue {
+    public:
+        explicit LockedQueue(size_t capacity) : _capacity(capacity) {}
+
+        bool try_push(const T& value) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_queue.size() >= _capacity) return false;
+            _queue.push(value);
+            return true;
+        }
+
+        bool try_pop(T& out) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_queue.empty()) return false;
+            out = _queue.front();
+            _queue.pop();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        MyQueue<T> _queue;
+        size_t _capacity;
+    };
+
+    void test_throughput_benchmark() {
+        const uint64_t TOTAL = 400000;
+        std::cout << "threads (P=C)   MyMPMCQueue      mutex + MyQueue" << std::endl;
+        for (int threads : {1, 2, 4, 8, 16, 32}) {
+            auto measure = [&](auto& q) {
+                uint64_t per_producer = TOTAL / threads;
+                std::atomic<uint64_t> consumed{0};
+                std::atomic<uint64_t> checksum{0};
+                std::vector<std::thread> workers;
+                auto t0 = std::chrono::steady_clock::now();
+                for (int p = 0; p < threads; ++p) {
+                    workers.emplace_back([&] {
+                        for (uint64_t i = 0; i < per_producer; ++i) {
+                            for (int spin = 0; !q.try_push(i); ++spin) {
+                                if (spin >= 64) std::this_thread::yield();
+                            }
+                        }
+                    });
+                }
+                for (int c = 0; c < threads; ++c) {
+                    workers.emplace_back([&] {
+                        uint64_t local = 0, v;
+                        for (int spin = 0; consumed.load(std::memory_order_relaxed) < per_producer * threads;) {
+                            if (q.try_pop(v)) {
+                                local += v;
+                                consumed.fetch_add(1, std::memory_order_relaxed);
+                                spin = 0;
+                            }
+                            else if (++spin >= 64) {
+                                std::this_thread::yield();
+                            }
+                        }
+                        checksum.fetch_add(local);
+                    });
+                }
+                for (auto& t : workers) t.join();
+                double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+                assert(checksum.load() == threads * (per_producer * (per_producer - 1) / 2));
+                return per_producer * threads / secs / 1e6;
+            };
+            MyMPMCQueue<uint64_t> lock_free(1024);
+            LockedQueue<uint64_t> locked(1024);
+            double a = measure(lock_free);
+            double b = measure(locked);
+            std::cout << "  " << threads << (threads < 10 ? " " : "") << "              "
+                      << a << " M/s      " << b << " M/s" << std::endl;
+        }
+    }
+
+    // --- 测试用例注册表 ---
+    static const std::vector<TestCase> mpmcqueue_test_cases = {
+        {"Basic Operations Test", test_basic_operations},
+        {"Bulk Operations Test", test_bulk_operations},
+        {"Move Only Test", test_move_only},
+        {"Stress Exactly Once Test", test_stress_exactly_once},
+        {"Stress Bulk Test", test_stress_bulk},
+        {"Stress Blocking Test", test_stress_blocking},
+        {"Throughput Benchmark", test_throughput_benchmark}
+    };
+
+    // --- get_test_cases ---
+    const std::vector<TestCase>& get_test_cases() {
+        return mpmcqueue_test_cases;
+    }
+
+    // --- run_all_tests ---
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyMPMCQueue Tests");
+        for (const auto& test_case : mpmcqueue_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyMPMCQueue Tests Complete");
+    }
+}
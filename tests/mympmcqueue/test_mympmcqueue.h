@@ -0,0 +1,20 @@
+#ifndef TEST_MYMPMCQUEUE_H
+#define TEST_MYMPMCQUEUE_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyMPMCQueue {
+    void test_basic_operations();
+    void test_bulk_operations();
+    void test_move_only();
+    void test_stress_exactly_once();
+    void test_stress_bulk();
+    void test_stress_blocking();
+    void test_throughput_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
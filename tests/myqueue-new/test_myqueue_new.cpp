@@ -1,13 +1,21 @@
 #include "myqueue-new/test_myqueue_new.h"
 #include "common/test_common.h"
 #include "MyQueue-new/MyQueue-new.h" // 包含您要测试的队列头文件
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <random>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace TestMyQueueNew {
 
     void test_basic_operations() {
-        MyQueue q;
+        MyTwoStackQueue<char> q;
         assert(q.size() == 0);
 
         // 测试 push 和 size
@@ -28,7 +36,7 @@ namespace TestMyQueueNew {
     }
 
     void test_pop_from_empty() {
-        MyQueue q;
+        MyTwoStackQueue<char> q;
         bool exception_thrown = false;
         try {
             q.pop(); // 应该抛出异常
@@ -39,7 +47,7 @@ namespace TestMyQueueNew {
     }
 
     void test_mixed_operations() {
-        MyQueue q;
+        MyTwoStackQueue<char> q;
 
         q.push('1');
         q.push('2');
@@ -62,11 +70,106 @@ namespace TestMyQueueNew {
         assert(q.size() == 0);
     }
 
+    void test_generic_types() {
+        // 任意元素类型；转移和 pop 都是移动，只能移动的类型也可以放进去
+        MyTwoStackQueue<std::unique_ptr<std::string>> q;
+        for (int i = 0; i < 10; ++i) q.push(std::make_unique<std::string>(std::to_string(i)));
+        assert(q.size() == 10);
+        assert(*q.front() == "0");
+        for (int i = 0; i < 5; ++i) assert(*q.pop() == std::to_string(i));
+        q.push(std::make_unique<std::string>("10"));
+        for (int i = 5; i <= 10; ++i) assert(*q.pop() == std::to_string(i));
+        assert(q.empty());
+    }
+
+    void test_incremental_mode() {
+        // 随机混合 push / pop，与 std::deque 的结果逐一比对；两种模式的行为必须完全一致
+        for (MyTransferMode mode : {MyTransferMode::Amortized, MyTransferMode::Incremental}) {
+            MyTwoStackQueue<std::string> q(mode);
+            std::deque<std::string> reference;
+            std::mt19937 rng(7);
+            int next = 0;
+            for (int op = 0; op < 20000; ++op) {
+                // 前半段偏向 push，后半段偏向 pop，让队列长度大幅起伏
+                bool push = reference.empty() || rng() % 100 < (op < 10000 ? 65u : 35u);
+                if (push) {
+                    std::string value = std::to_string(next++);
+                    q.push(value);
+                    reference.push_back(value);
+                }
+                else {
+                    assert(q.front() == reference.front());
+                    assert(q.pop() == reference.front());
+                    reference.pop_front();
+                }
+                assert(q.size() == reference.size());
+            }
+            while (!reference.empty()) {
+                assert(q.pop() == reference.front());
+                reference.pop_front();
+            }
+            assert(q.empty());
+        }
+
+        bool exception_thrown = false;
+        MyTwoStackQueue<int> q(MyTransferMode::Incremental);
+        try {
+            q.front();
+        } catch (const std::out_of_range&) {
+            exception_thrown = true;
+        }
+        assert(exception_thrown);
+    }
+
+    void test_latency_benchmark() {
+        // 先连续 push N 个，再连续 pop N 个：Amortized 模式的第一次 pop 要一次性反转整个 _in。
+        // 预先 reserve，排除 MyVector 扩容的影响，只比较转移本身。
+        // 单次最大值容易被调度抖动淹没，所以单独统计“长串 push 之后第一次 pop”的耗时 (取各轮的中位数)
+        const int N = 300000;
+        const int ROUNDS = 5;
+        using Clock = std::chrono::steady_clock;
+        for (MyTransferMode mode : {MyTransferMode::Amortized, MyTransferMode::Incremental}) {
+            std::vector<double> latency;
+            std::vector<double> first_pop;
+            latency.reserve(static_cast<size_t>(N) * 2 * ROUNDS);
+            MyTwoStackQueue<int> q(mode);
+            q.reserve(N);
+            long long sum = 0;
+            auto start = Clock::now();
+            for (int round = 0; round < ROUNDS; ++round) {
+                for (int i = 0; i < N; ++i) {
+                    auto t0 = Clock::now();
+                    q.push(i);
+                    latency.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count());
+                }
+                for (int i = 0; i < N; ++i) {
+                    auto t0 = Clock::now();
+                    sum += q.pop();
+                    latency.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count());
+                    if (i == 0) first_pop.push_back(latency.back());
+                }
+            }
+            double total = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            assert(sum == static_cast<long long>(N) * (N - 1) / 2 * ROUNDS);
+
+            double mean = total / latency.size();
+            std::sort(latency.begin(), latency.end());
+            std::sort(first_pop.begin(), first_pop.end());
+            std::cout << (mode == MyTransferMode::Amortized ? "Amortized  " : "Incremental")
+                      << ": mean " << mean << " ns/op (incl. timer), p99.99 "
+                      << latency[static_cast<size_t>(0.9999 * (latency.size() - 1))]
+                      << " ns, first pop after " << N << " pushes " << first_pop[ROUNDS / 2] << " ns" << std::endl;
+        }
+    }
+
     // 创建测试用例注册表
     static const std::vector<TestCase> myqueue_new_test_cases = {
         {"Basic Operations Test", test_basic_operations},
         {"Pop from Empty Test", test_pop_from_empty},
-        {"Mixed Operations Test", test_mixed_operations}
+        {"Mixed Operations Test", test_mixed_operations},
+        {"Generic Types Test", test_generic_types},
+        {"Incremental Mode Test", test_incremental_mode},
+        {"Latency Benchmark", test_latency_benchmark}
     };
 
     // 获取测试用例列表
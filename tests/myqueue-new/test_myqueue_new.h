@@ -14,6 +14,15 @@ namespace TestMyQueueNew {
     // 测试混合的 push 和 pop 操作，以验证两个栈之间的元素转移逻辑
     void test_mixed_operations();
 
+    // 测试任意元素类型 (包括只能移动的类型)
+    void test_generic_types();
+
+    // 测试增量转移模式：随机操作序列与 std::deque 逐一比对
+    void test_incremental_mode();
+
+    // 比较两种转移模式的平均延迟和最坏延迟
+    void test_latency_benchmark();
+
     // 获取测试用例列表
     const std::vector<TestCase>& get_test_cases();
 
@@ -1,7 +1,12 @@
 #include "myqueue/test_myqueue.h"
 #include "common/test_common.h"
 #include "MyQueue.h"
+#include "MyRingBuffer.h"
+#include "MyDeque.h"
 #include <cassert>
+#include <chrono>
+#include <memory>
+#include <string>
 
 namespace TestMyQueue {
     void test_queue_operations() {
@@ -36,9 +41,118 @@ namespace TestMyQueue {
         assert(q.empty());
     }
 
+    void test_ring_buffer() {
+        MyRingBuffer<int> ring;
+        assert(ring.empty() && ring.capacity() == 0);
+
+        // 队列深度稳定时反复绕圈，不会扩容
+        ring.reserve(8);
+        assert(ring.capacity() == 8);
+        int next_in = 0, next_out = 0;
+        for (int i = 0; i < 5; ++i) ring.push_back(next_in++);
+        for (int round = 0; round < 100; ++round) {
+            ring.push_back(next_in++);
+            assert(ring.front() == next_out++);
+            ring.pop_front();
+        }
+        assert(ring.capacity() == 8 && ring.size() == 5);
+
+        // 绕回的状态下扩容，顺序保持不变
+        for (int i = 0; i < 20; ++i) ring.push_back(next_in++);
+        assert(ring.capacity() == 32 && ring.size() == 25);
+        for (size_t i = 0; i < ring.size(); ++i) assert(ring[i] == next_out + static_cast<int>(i));
+        assert(ring.back() == next_in - 1);
+
+        // 两端都可以进出
+        ring.push_front(-1);
+        assert(ring.front() == -1);
+        ring.pop_back();
+        assert(ring.back() == next_in - 2);
+
+        // 拷贝和移动
+        MyRingBuffer<int> copy = ring;
+        assert(copy.size() == ring.size() && copy.front() == -1);
+        copy.pop_front();
+        assert(ring.front() == -1);
+        MyRingBuffer<int> moved = std::move(copy);
+        assert(copy.empty() && moved.front() == next_out);
+
+        // push 一个引用着自身元素的值，正好触发扩容
+        MyRingBuffer<std::string> strings(2);
+        strings.push_back("a");
+        strings.push_back("b");
+        strings.push_back(strings.front());
+        assert(strings.size() == 3 && strings.back() == "a");
+
+        // 只能移动的类型：扩容时移动而不是拷贝
+        MyRingBuffer<std::unique_ptr<int>> owners;
+        for (int i = 0; i < 100; ++i) owners.push_back(std::make_unique<int>(i));
+        for (int i = 0; i < 100; ++i) {
+            assert(*owners.front() == i);
+            owners.pop_front();
+        }
+
+        bool thrown = false;
+        try { owners.pop_front(); } catch (const std::out_of_range&) { thrown = true; }
+        assert(thrown);
+    }
+
+    template <typename Queue>
+    static void check_queue_backend() {
+        Queue q;
+        for (int i = 0; i < 1000; ++i) q.push(i);
+        assert(q.size() == 1000 && q.front() == 0 && q.back() == 999);
+        for (int i = 0; i < 500; ++i) q.pop();
+        for (int i = 1000; i < 1200; ++i) q.push(i);
+        int expected = 500;
+        while (!q.empty()) {
+            assert(q.front() == expected++);
+            q.pop();
+        }
+        assert(expected == 1200);
+        bool thrown = false;
+        try { q.pop(); } catch (const std::out_of_range&) { thrown = true; }
+        assert(thrown);
+    }
+
+    void test_queue_backends() {
+        check_queue_backend<MyQueue<int>>();
+        check_queue_backend<MyQueue<int, MyRingBuffer<int>>>();
+        check_queue_backend<MyQueue<int, MyDeque<int>>>();
+    }
+
+    // 稳定深度下的入队 + 出队吞吐：链表 vs 环形缓冲区 vs 分块数组
+    void test_backend_benchmark() {
+        const int DEPTH = 1000;
+        const int OPS = 2000000;
+        auto run = [&](const char* label, auto& q) {
+            for (int i = 0; i < DEPTH; ++i) q.push(i);
+            auto t0 = std::chrono::steady_clock::now();
+            long long sum = 0;
+            for (int i = 0; i < OPS; ++i) {
+                q.push(i);
+                sum += q.front();
+                q.pop();
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            assert(q.size() == static_cast<size_t>(DEPTH) && sum > 0);
+            double secs = std::chrono::duration<double>(t1 - t0).count();
+            std::cout << label << ": " << OPS / secs / 1e6 << " M push+pop/s" << std::endl;
+        };
+        MyQueue<int> list_queue;
+        MyQueue<int, MyRingBuffer<int>> ring_queue;
+        MyQueue<int, MyDeque<int>> deque_queue;
+        run("MyLinkedList backend", list_queue);
+        run("MyRingBuffer backend", ring_queue);
+        run("MyDeque backend     ", deque_queue);
+    }
+
     // --- 测试用例注册表 ---
     static const std::vector<TestCase> queue_test_cases = {
-        {"Queue Operations Test", test_queue_operations}
+        {"Queue Operations Test", test_queue_operations},
+        {"Ring Buffer Test", test_ring_buffer},
+        {"Queue Backends Test", test_queue_backends},
+        {"Backend Throughput Benchmark", test_backend_benchmark}
     };
 
     // --- get_test_cases ---
@@ -6,6 +6,9 @@
 
 namespace TestMyQueue {
     void test_queue_operations();
+    void test_ring_buffer();
+    void test_queue_backends();
+    void test_backend_benchmark();
     void run_all_tests();
 
     const std::vector<TestCase>& get_test_cases();
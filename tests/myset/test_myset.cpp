@@ -1,8 +1,14 @@
 #include "test_myset.h"
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
 #include <stdexcept>
+#include <vector>
 #include "common/test_common.h"
 #include "MySet.h"
+#include "MySetPro.h"
 
 namespace TestMySet {
 
@@ -80,12 +86,143 @@ namespace TestMySet {
         std::cout << "Clear and Empty Test Passed." << std::endl;
     }
 
+    void test_avl_engine() {
+        // 顺序到达的键：默认的 MyBST 会退化成链表，MyAVLTree 引擎保持 O(log n)
+        MySet<int, MyAVLTree> s;
+        const int N = 100000;
+        for (int i = 0; i < N; ++i) s.insert(i);
+        s.insert(42);
+        if (s.size() != N) throw std::runtime_error("AVL engine test failed: Size is incorrect.");
+        for (int i = 0; i < N; i += 2) s.erase(i);
+        if (s.size() != N / 2) throw std::runtime_error("AVL engine test failed: Size after erase is incorrect.");
+        if (s.contains(0) || !s.contains(1) || !s.contains(N - 1)) {
+            throw std::runtime_error("AVL engine test failed: Wrong membership after erase.");
+        }
+        std::cout << "AVL Engine Test Passed." << std::endl;
+    }
+
+    void test_order_statistics() {
+        MySet<int, MyAVLTree> s;
+        for (int v : {40, 10, 30, 20, 50}) s.insert(v);
+
+        if (s.select(0) == nullptr || *s.select(0) != 10 || *s.select(4) != 50) {
+            throw std::runtime_error("Order statistics test failed: select returned the wrong element.");
+        }
+        if (s.select(5) != nullptr) throw std::runtime_error("Order statistics test failed: select past the end should be null.");
+        if (s.rank(30) != 2 || s.rank(35) != 3 || s.rank(5) != 0 || s.rank(99) != 5) {
+            throw std::runtime_error("Order statistics test failed: rank is incorrect.");
+        }
+        if (s.count_in_range(20, 50) != 3 || s.count_in_range(0, 100) != 5 || s.count_in_range(50, 20) != 0) {
+            throw std::runtime_error("Order statistics test failed: count_in_range is incorrect.");
+        }
+        s.erase(30);
+        if (*s.select(2) != 40 || s.rank(50) != 3) {
+            throw std::runtime_error("Order statistics test failed: wrong result after erase.");
+        }
+        std::cout << "Order Statistics Test Passed." << std::endl;
+    }
+
+    void test_range_queries() {
+        MySet<int> s;
+        for (int v = 0; v < 100; v += 5) s.insert(v); // 0, 5, ..., 95
+
+        std::vector<int> window;
+        for (int v : s.range(12, 31)) window.push_back(v);
+        if (window != std::vector<int>{15, 20, 25, 30}) throw std::runtime_error("Range test failed: wrong elements in [12, 31).");
+
+        int count = 0;
+        s.for_each_in_range(40, 60, [&](const int&) { count++; }); // 60 不在区间里
+        if (count != 4) throw std::runtime_error("Range test failed: for_each_in_range visited the wrong number of elements.");
+
+        std::vector<int> first_two;
+        s.for_each_in_range(0, 100, [&](const int& v) {
+            first_two.push_back(v);
+            return first_two.size() < 2;
+        });
+        if (first_two != std::vector<int>{0, 5}) throw std::runtime_error("Range test failed: early termination did not stop the scan.");
+
+        if (!s.range(96, 200).empty() || !s.range(50, 50).empty()) {
+            throw std::runtime_error("Range test failed: range should be empty.");
+        }
+        std::cout << "Range Queries Test Passed." << std::endl;
+    }
+
+    void test_build_from_sorted() {
+        std::vector<int> snapshot;
+        for (int i = 0; i < 10000; ++i) snapshot.push_back(i * 2);
+        MySet<int> s;
+        s.insert(1);
+        s.build_from_sorted(snapshot.begin(), snapshot.end());
+        if (s.size() != snapshot.size() || s.contains(1) || !s.contains(19998)) {
+            throw std::runtime_error("Build from sorted test failed: wrong contents after bulk load.");
+        }
+        if (*s.select(1234) != 2468 || s.count_in_range(100, 200) != 50) {
+            throw std::runtime_error("Build from sorted test failed: order statistics are wrong after bulk load.");
+        }
+        s.insert(1);
+        s.erase(0);
+        if (s.size() != snapshot.size() || !s.contains(1) || s.contains(0)) {
+            throw std::runtime_error("Build from sorted test failed: insert/erase after bulk load.");
+        }
+        std::vector<int> unsorted = {3, 1, 2};
+        bool thrown = false;
+        try {
+            s.build_from_sorted(unsorted.begin(), unsorted.end());
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        if (!thrown || s.size() != snapshot.size()) {
+            throw std::runtime_error("Build from sorted test failed: unsorted input should throw and leave the set unchanged.");
+        }
+        std::cout << "Build From Sorted Test Passed." << std::endl;
+    }
+
+    void test_bulk_load_benchmark() {
+        // 需求里是 5000 万个键；默认构建没开优化，这里缩小到 100 万，比较的是 build_from_sorted 和逐个 insert
+        const int N = 1000000;
+        std::vector<int> sorted(N);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        std::vector<int> shuffled(sorted);
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(31));
+
+        using Clock = std::chrono::steady_clock;
+        auto ms = [](Clock::time_point t0) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        };
+        auto run = [&](const char* label, auto make_set, const std::vector<int>& insert_order) {
+            auto bulk = make_set();
+            auto t0 = Clock::now();
+            bulk.build_from_sorted(sorted.begin(), sorted.end());
+            double build_ms = ms(t0);
+
+            auto incremental = make_set();
+            t0 = Clock::now();
+            for (int k : insert_order) incremental.insert(k);
+            double insert_ms = ms(t0);
+
+            if (bulk.size() != static_cast<size_t>(N) || incremental.size() != static_cast<size_t>(N)) {
+                throw std::runtime_error("Bulk load benchmark: wrong size.");
+            }
+            std::cout << label << ": build_from_sorted " << build_ms << " ms, " << N << " x insert ("
+                      << (&insert_order == &sorted ? "sorted" : "random") << ") " << insert_ms << " ms" << std::endl;
+        };
+        // MyBST 逐个插入有序数据是 O(n^2)，只能拿随机顺序来比
+        run("MySet<int> (MyBST)     ", [] { return MySet<int>(); }, shuffled);
+        run("MySet<int, MyAVLTree>  ", [] { return MySet<int, MyAVLTree>(); }, sorted);
+        run("MySetPro<int> (MyTreap)", [] { return MySetPro<int>(); }, sorted);
+    }
+
     // --- 注册所有测试用例 ---
     static const std::vector<TestCase> myset_test_cases = {
         {"Insert and Contains", test_insert_and_contains},
         {"Duplicates", test_duplicates},
         {"Erase", test_erase},
-        {"Clear and Empty", test_clear_and_empty}
+        {"Clear and Empty", test_clear_and_empty},
+        {"AVL Engine", test_avl_engine},
+        {"Order Statistics", test_order_statistics},
+        {"Range Queries", test_range_queries},
+        {"Build From Sorted", test_build_from_sorted},
+        {"Bulk Load Benchmark", test_bulk_load_benchmark}
     };
 
     // --- 实现管理函数 ---
@@ -7,6 +7,11 @@ namespace TestMySet {
     void test_duplicates();
     void test_erase();
     void test_clear_and_empty();
+    void test_avl_engine();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_build_from_sorted();
+    void test_bulk_load_benchmark();
 
     const std::vector<TestCase>& get_test_cases();
     void run_all_tests();
@@ -7,6 +7,9 @@ namespace TestMySetPro {
     void test_duplicates();
     void test_erase();
     void test_clear_and_empty();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_build_from_sorted();
 
     const std::vector<TestCase>& get_test_cases();
     void run_all_tests();
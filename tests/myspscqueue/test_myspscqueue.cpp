@@ -0,0 +1,272 @@
+#include "myspscqueue/test_myspscqueue.h"
+#include "common/test_common.h"
+#include "MySPSCQueue.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace TestMySPSCQueue {
+    void test_basic_operations() {
+        MySPSCQueue<int> q(5);
+        assert(q.capacity() == 8); // 向上取整到 2 的幂
+        assert(q.empty_approx());
+
+        int out = -1;
+        assert(!q.try_pop(out) && out == -1);
+
+        for (int i = 0; i < 8; ++i) assert(q.try_push(i));
+        assert(!q.try_push(100)); // 满了
+        assert(q.size_approx() == 8);
+
+        for (int i = 0; i < 8; ++i) {
+            assert(q.try_pop(out) && out == i);
+        }
+        assert(!q.try_pop(out));
+        assert(q.empty_approx());
+    }
+
+    void test_wrap_around() {
+        // 容量很小，反复绕圈，检查 FIFO 顺序和满 / 空判断
+        MySPSCQueue<std::string> q(4);
+        int next_in = 0, next_out = 0;
+        for (int round = 0; round < 1000; ++round) {
+            while (q.try_push(std::to_string(next_in))) next_in++;
+            assert(q.size_approx() == 4);
+            int take = 1 + round % 4;
+            std::string out;
+            for (int i = 0; i < take; ++i) {
+                assert(q.try_pop(out) && out == std::to_string(next_out++));
+            }
+        }
+        // 剩下的元素由析构函数释放
+    }
+
+    void test_bulk_operations() {
+        MySPSCQueue<int> q(16);
+        std::vector<int> input(20);
+        for (int i = 0; i < 20; ++i) input[i] = i;
+
+        // 只放得下 16 个
+        assert(q.try_push_bulk(input.data(), 20) == 16);
+        assert(q.try_push_bulk(input.data(), 1) == 0);
+
+        int out[32];
+        assert(q.try_pop_bulk(out, 10) == 10);
+        for (int i = 0; i < 10; ++i) assert(out[i] == i);
+
+        // 跨过数组末尾的一批
+        assert(q.try_push_bulk(input.data() + 16, 4) == 4);
+        assert(q.try_pop_bulk(out, 32) == 10);
+        for (int i = 0; i < 10; ++i) assert(out[i] == 10 + i);
+        assert(q.try_pop_bulk(out, 32) == 0);
+    }
+
+    void test_move_only() {
+        MySPSCQueue<std::unique_ptr<int>> q(2);
+        assert(q.try_push(std::make_unique<int>(1)));
+        assert(q.try_push(std::make_unique<int>(2)));
+
+        // 失败的 try_push 不会拿走参数
+        auto third = std::make_unique<int>(3);
+        assert(!q.try_push(std::move(third)));
+        assert(third && *third == 3);
+
+        std::unique_ptr<int> out;
+        assert(q.try_pop(out) && *out == 1);
+        q.push(std::move(third));
+        assert(q.try_pop(out) && *out == 2);
+        q.pop(out);
+        assert(*out == 3);
+    }
+
+    // 生产者按顺序推送 0..N-1，消费者必须按同样的顺序收到每一个值
+    template <typename Push, typename Pop>
+    static void run_two_threads(long long count, Push push, Pop pop) {
+        std::thread producer([&] {
+            for (long long i = 0; i < count; ++i) push(i);
+        });
+        long long expected = 0;
+        while (expected < count) {
+            long long value = pop();
+            assert(value == expected);
+            expected++;
+        }
+        producer.join();
+    }
+
+    void test_two_thread_order() {
+        const long long N = 200000;
+        {
+            MySPSCQueue<long long> q(64);
+            run_two_threads(N,
+                [&](long long v) { while (!q.try_push(v)) std::this_thread::yield(); },
+                [&] { long long v; while (!q.try_pop(v)) std::this_thread::yield(); return v; });
+            assert(q.empty_approx());
+        }
+        {
+            // 生产者和消费者都走批量接口，每批大小不同
+            MySPSCQueue<long long> q(64);
+            std::thread producer([&] {
+                long long buffer[37];
+                long long next = 0;
+                while (next < N) {
+                    size_t n = static_cast<size_t>(std::min<long long>(37, N - next));
+                    for (size_t i = 0; i < n; ++i) buffer[i] = next + i;
+                    size_t sent = 0;
+                    while (sent < n) {
+                        size_t pushed = q.try_push_bulk(buffer + sent, n - sent);
+                        if (pushed == 0) std::this_thread::yield();
+                        sent += pushed;
+                    }
+                    next += n;
+                }
+            });
+            long long buffer[23];
+            long long expected = 0;
+            while (expected < N) {
+                size_t popped = q.try_pop_bulk(buffer, 23);
+                if (popped == 0) std::this_thread::yield();
+                for (size_t i = 0; i < popped; ++i) {
+                    assert(buffer[i] == expected);
+                    expected++;
+                }
+            }
+            producer.join();
+        }
+    }
+
+    void test_blocking_wait() {
+        // 两种等待策略下，阻塞的 push / pop 都不能丢失唤醒
+        const long long N = 100000;
+        for (MyWaitStrategy wait : {MyWaitStrategy::Spin, MyWaitStrategy::Block}) {
+            MySPSCQueue<long long> q(8, wait);
+            run_two_threads(N,
+                [&](long long v) { q.push(v); },
+                [&] { long long v; q.pop(v); return v; });
+            assert(q.empty_approx());
+        }
+
+        // 消费者先睡下，生产者稍后才推送
+        MySPSCQueue<int> q(4, MyWaitStrategy::Block);
+        std::thread consumer([&] {
+            int out = 0;
+            q.pop(out);
+            assert(out == 42);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        q.push(42);
+        consumer.join();
+    }
+
+    void test_throughput_benchmark() {
+        const long long N = 2000000;
+        auto report = [](const char* label, long long count, std::chrono::steady_clock::time_point t0) {
+            double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            std::cout << label << ": " << count / secs / 1e6 << " M items/s" << std::endl;
+        };
+
+        for (MyWaitStrategy wait : {MyWaitStrategy::Spin, MyWaitStrategy::Block}) {
+            MySPSCQueue<long long> q(1024, wait);
+            auto t0 = std::chrono::steady_clock::now();
+            long long sum = 0;
+            run_two_threads(N,
+                [&](long long v) { q.push(v); },
+                [&] { long long v; q.pop(v); sum += v; return v; });
+            assert(sum == N * (N - 1) / 2);
+            report(wait == MyWaitStrategy::Spin ? "push/pop (spin)       " : "push/pop (futex)      ", N, t0);
+        }
+
+        {
+            const size_t BATCH = 64;
+            MySPSCQueue<long long> q(1024);
+            auto t0 = std::chrono::steady_clock::now();
+            std::thread producer([&] {
+                long long buffer[BATCH];
+                for (long long next = 0; next < N; next += BATCH) {
+                    for (size_t i = 0; i < BATCH; ++i) buffer[i] = next + i;
+                    size_t sent = 0;
+                    while (sent < BATCH) {
+                        size_t pushed = q.try_push_bulk(buffer + sent, BATCH - sent);
+                        if (pushed == 0) std::this_thread::yield();
+                        sent += pushed;
+                    }
+                }
+            });
+            long long buffer[BATCH];
+            long long received = 0, sum = 0;
+            while (received < N) {
+                size_t popped = q.try_pop_bulk(buffer, BATCH);
+                if (popped == 0) std::this_thread::yield();
+                for (size_t i = 0; i < popped; ++i) sum += buffer[i];
+                received += popped;
+            }
+            producer.join();
+            assert(sum == N * (N - 1) / 2);
+            report("bulk x64 (spin)       ", N, t0);
+        }
+    }
+
+    void test_latency_benchmark() {
+        // 乒乓：一个线程发出请求，另一个线程原样返回，测往返时间 (两次入队 + 两次出队 + 两次线程切换/缓存行迁移)
+        const int ROUNDS = 20000;
+        for (MyWaitStrategy wait : {MyWaitStrategy::Spin, MyWaitStrategy::Block}) {
+            MySPSCQueue<int> request(16, wait), response(16, wait);
+            std::thread echo([&] {
+                int v = 0;
+                for (int i = 0; i < ROUNDS; ++i) {
+                    request.pop(v);
+                    response.push(v);
+                }
+            });
+            std::vector<double> rtt;
+            rtt.reserve(ROUNDS);
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto t0 = std::chrono::steady_clock::now();
+                request.push(i);
+                int v = -1;
+                response.pop(v);
+                auto t1 = std::chrono::steady_clock::now();
+                assert(v == i);
+                rtt.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            }
+            echo.join();
+            std::sort(rtt.begin(), rtt.end());
+            std::cout << (wait == MyWaitStrategy::Spin ? "round trip (spin) " : "round trip (futex)")
+                      << ": p50 " << rtt[ROUNDS / 2] << " us, p99 " << rtt[ROUNDS * 99 / 100]
+                      << " us, max " << rtt.back() << " us" << std::endl;
+        }
+    }
+
+    // --- 测试用例注册表 ---
+    static const std::vector<TestCase> spscqueue_test_cases = {
+        {"Basic Operations Test", test_basic_operations},
+        {"Wrap Around Test", test_wrap_around},
+        {"Bulk Operations Test", test_bulk_operations},
+        {"Move Only Test", test_move_only},
+        {"Two Thread Order Test", test_two_thread_order},
+        {"Blocking Wait Test", test_blocking_wait},
+        {"Throughput Benchmark", test_throughput_benchmark},
+        {"Latency Benchmark", test_latency_benchmark}
+    };
+
+    // --- get_test_cases ---
+    const std::vector<TestCase>& get_test_cases() {
+        return spscqueue_test_cases;
+    }
+
+    // --- run_all_tests ---
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MySPSCQueue Tests");
+        for (const auto& test_case : spscqueue_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MySPSCQueue Tests Complete");
+    }
+}
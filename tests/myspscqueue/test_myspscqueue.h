@@ -0,0 +1,21 @@
+#ifndef TEST_MYSPSCQUEUE_H
+#define TEST_MYSPSCQUEUE_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMySPSCQueue {
+    void test_basic_operations();
+    void test_wrap_around();
+    void test_bulk_operations();
+    void test_move_only();
+    void test_two_thread_order();
+    void test_blocking_wait();
+    void test_throughput_benchmark();
+    void test_latency_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
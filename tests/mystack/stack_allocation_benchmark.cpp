@@ -0,0 +1,158 @@
+// tests/mystack/stack_allocation_benchmark.cpp
+//
+// 栈的分配次数基准测试，单独编译成 MySTL_alloc_benchmark。
+//
+// 统计分配次数需要替换全局 operator new / operator delete。替换是对整个程序生效的，
+// 放在 MySTL 里会让所有测试组 (包括多线程的基准测试) 都走这里的计数，所以单独成一个可执行文件。
+// 替换时必须把整组分配 / 释放函数 (普通、nothrow、数组、对齐，以及对应的 delete) 都换掉：
+// 只换一部分的话，标准库用没替换的版本 (例如 std::stable_sort 用的 nothrow new) 分配、
+// 再用替换过的 delete 释放，就是不匹配的分配 / 释放。
+#include "common/test_common.h"
+#include "MyStack.h"
+#include "MySmallStack.h"
+#include "MyBST.h"
+#include "MyTreap.h"
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <vector>
+
+static size_t g_allocation_count = 0; // 基准测试是单线程的
+
+static void* counted_alloc(std::size_t size) {
+    g_allocation_count++;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+static void* counted_aligned_alloc(std::size_t size, std::align_val_t align) {
+    g_allocation_count++;
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+    // aligned_alloc 要求 size 是 alignment 的整数倍
+    std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = counted_alloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    if (void* p = counted_aligned_alloc(size, align)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t align) { return ::operator new(size, align); }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return counted_aligned_alloc(size, align);
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return counted_aligned_alloc(size, align);
+}
+
+// 上面所有版本都来自 malloc / aligned_alloc，统一用 free 释放
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+namespace TestMyStack {
+
+    // 后缀表达式 (逆波兰式) 的记号：op 为 0 时是操作数
+    struct RpnToken {
+        char op;
+        long long value;
+    };
+
+    // 用栈求后缀表达式的值
+    template <typename Stack>
+    static long long eval_rpn(const std::vector<RpnToken>& tokens) {
+        Stack stack;
+        for (const RpnToken& token : tokens) {
+            if (token.op == 0) {
+                stack.push(token.value);
+                continue;
+            }
+            long long rhs = stack.top();
+            stack.pop();
+            long long lhs = stack.top();
+            stack.pop();
+            stack.push(token.op == '+' ? lhs + rhs : token.op == '-' ? lhs - rhs : lhs * rhs);
+        }
+        return stack.top();
+    }
+
+    void test_allocation_benchmark() {
+        // 1. 表达式求值：每次求值创建一个新栈，深度只有几层
+        // (3 + 4) * (5 - 2) - 6 * (1 + 1) = 9
+        const std::vector<RpnToken> tokens = {
+            {0, 3}, {0, 4}, {'+', 0}, {0, 5}, {0, 2}, {'-', 0}, {'*', 0},
+            {0, 6}, {0, 1}, {0, 1}, {'+', 0}, {'*', 0}, {'-', 0}
+        };
+        const int EVALS = 200000;
+        auto run_rpn = [&](const char* label, auto eval) {
+            long long sum = 0;
+            size_t allocations_before = g_allocation_count;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < EVALS; ++i) sum += eval(tokens);
+            auto t1 = std::chrono::steady_clock::now();
+            size_t allocations = g_allocation_count - allocations_before;
+            assert(sum == 9LL * EVALS);
+            std::cout << label << ": " << static_cast<double>(allocations) / EVALS << " allocations/eval, "
+                      << std::chrono::duration<double, std::nano>(t1 - t0).count() / EVALS << " ns/eval" << std::endl;
+        };
+        run_rpn("RPN eval, MyStack<long long>        ", eval_rpn<MyStack<long long>>);
+        run_rpn("RPN eval, MySmallStack<long long, 8>", eval_rpn<MySmallStack<long long, 8>>);
+
+        // 2. 树的迭代遍历：完全平衡的 BST (高 10) 和 Treap，遍历本身不应分配内存
+        MyBST<int> bst;
+        MyTreap<int> treap;
+        std::vector<int> keys;
+        for (int step = 512; step >= 1; step /= 2) {
+            for (int k = step; k < 1024; k += 2 * step) keys.push_back(k);
+        }
+        for (int k : keys) {
+            bst.insert(k);
+            treap.insert(k);
+        }
+        const int WALKS = 2000;
+        auto run_walk = [&](const char* label, auto walk) {
+            long long sum = 0;
+            std::function<void(const int&)> visit = [&](const int& v) { sum += v; };
+            size_t allocations_before = g_allocation_count;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < WALKS; ++i) walk(visit);
+            auto t1 = std::chrono::steady_clock::now();
+            size_t allocations = g_allocation_count - allocations_before;
+            assert(sum == 1023LL * 1024 / 2 * WALKS);
+            assert(allocations == 0);
+            std::cout << label << ": " << static_cast<double>(allocations) / WALKS << " allocations/walk, "
+                      << std::chrono::duration<double, std::micro>(t1 - t0).count() / WALKS << " us/walk" << std::endl;
+        };
+        run_walk("MyBST inorder (1023 nodes)  ", [&](const std::function<void(const int&)>& f) { bst.inorder(f); });
+        run_walk("MyBST postorder (1023 nodes)", [&](const std::function<void(const int&)>& f) { bst.postorder(f); });
+        run_walk("MyTreap inorder (1023 nodes)", [&](const std::function<void(const int&)>& f) { treap.inorder(f); });
+    }
+
+} // namespace TestMyStack
+
+int main() {
+    TestRunner::print_separator("MyStack Allocation Benchmark");
+    TestRunner::run_test("Allocation Benchmark", TestMyStack::test_allocation_benchmark);
+    TestRunner::print_summary();
+    return 0;
+}
@@ -1,7 +1,11 @@
 #include "mystack/test_mystack.h"
 #include "common/test_common.h"
 #include "MyStack.h"
+#include "MySmallStack.h"
 #include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace TestMyStack {
 
@@ -37,9 +41,58 @@ namespace TestMyStack {
         assert(s.empty());
     }
 
+    void test_small_stack() {
+        MySmallStack<std::string, 4> s;
+        assert(s.empty() && s.is_inline() && s.capacity() == 4);
+
+        // 不超过内联容量时不分配内存
+        for (int i = 0; i < 4; ++i) s.push(std::to_string(i));
+        assert(s.is_inline() && s.size() == 4);
+        assert(s.top() == "3");
+
+        // 超过之后溢出到堆上，元素保持不变
+        s.push("4");
+        s.emplace(3, 'x');
+        assert(!s.is_inline() && s.capacity() == 8 && s.size() == 6);
+        assert(s.top() == "xxx");
+        s.push(s.top()); // 参数引用着栈里的元素
+        assert(s.top() == "xxx" && s.size() == 7);
+
+        // 拷贝和移动：堆上的直接接管缓冲区，内联的逐个移动
+        MySmallStack<std::string, 4> copy(s);
+        assert(copy.size() == 7 && copy.top() == "xxx");
+        MySmallStack<std::string, 4> moved(std::move(copy));
+        assert(moved.size() == 7 && copy.empty() && copy.is_inline());
+
+        MySmallStack<std::string, 4> small;
+        small.push("a");
+        small.push("b");
+        MySmallStack<std::string, 4> moved_small(std::move(small));
+        assert(moved_small.is_inline() && moved_small.top() == "b" && small.empty());
+        moved = moved_small;
+        assert(moved.size() == 2 && moved.top() == "b");
+        moved = std::move(s);
+        assert(moved.size() == 7 && !moved.is_inline());
+
+        for (int i = 6; i >= 0; --i) {
+            moved.pop();
+        }
+        assert(moved.empty());
+        moved.pop(); // 与 MyStack 一致，空栈 pop 不做任何事
+
+        bool exception_thrown = false;
+        try {
+            moved.top();
+        } catch (const std::out_of_range&) {
+            exception_thrown = true;
+        }
+        assert(exception_thrown);
+    }
+
     // --- 创建测试用例注册表 ---
     static const std::vector<TestCase> mystack_test_cases = {
-        {"Stack Operations Test", test_stack_operations}
+        {"Stack Operations Test", test_stack_operations},
+        {"Small Stack Test", test_small_stack}
     };
 
     // --- 实现 get_test_cases 函数 ---
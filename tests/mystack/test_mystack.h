@@ -6,6 +6,7 @@
 
 namespace TestMyStack {
     void test_stack_operations();
+    void test_small_stack();
     void run_all_tests();
 
     const std::vector<TestCase>& get_test_cases();
@@ -0,0 +1,209 @@
+#include "myswisshashmap/test_myswisshashmap.h"
+#include "common/test_common.h"
+#include "MySwissHashMap.h"
+#include "MyFlatHashMap.h"
+#include "MyHashMap.h"
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace TestMySwissHashMap {
+
+    void test_insert_and_access() {
+        MySwissHashMap<std::string, int> map;
+        assert(map.size() == 0);
+
+        map.insert("one", 1);
+        map.insert("two", 2);
+        assert(map.size() == 2);
+        assert(map["one"] == 1);
+        assert(map["two"] == 2);
+
+        map.insert("one", 111);
+        assert(map.size() == 2);
+        assert(map["one"] == 111);
+
+        assert(map["three"] == 0);
+        assert(map.size() == 3);
+
+        map["four"] = 4;
+        assert(map["four"] == 4);
+        assert(map.size() == 4);
+    }
+
+    void test_find_and_erase() {
+        MySwissHashMap<std::string, int> map;
+        map.insert("one", 1);
+        map.insert("two", 2);
+        map.insert("three", 3);
+
+        int* val_ptr = map.find("two");
+        assert(val_ptr != nullptr && *val_ptr == 2);
+        assert(map.find("four") == nullptr);
+
+        assert(map.erase("one"));
+        assert(!map.erase("one"));
+        assert(map.size() == 2);
+        assert(map.find("one") == nullptr);
+        assert(*map.find("three") == 3);
+
+        map.clear();
+        assert(map.empty());
+        assert(map.find("two") == nullptr);
+    }
+
+    void test_rehash() {
+        // 最小容量是一个组 (16 个槽位)，负载因子 7/8
+        MySwissHashMap<int, int> map(4);
+        assert(map.bucket_count() == 16);
+
+        for (int i = 0; i < 14; ++i) map.insert(i, i * 10);
+        assert(map.bucket_count() == 16);
+
+        map.insert(14, 140); // 超过 14 个元素，触发扩容
+        assert(map.bucket_count() == 32);
+        for (int i = 0; i < 15; ++i) {
+            assert(map.find(i) != nullptr && *map.find(i) == i * 10);
+        }
+    }
+
+    static void randomized_against_std(bool use_simd) {
+        MySwissHashMap<int, int> map;
+        map.set_simd_enabled(use_simd);
+        assert(map.simd_enabled() == (use_simd && MySwissHashMap<int, int>::simd_available()));
+
+        std::unordered_map<int, int> reference;
+        std::mt19937 gen(use_simd ? 7 : 8);
+        std::uniform_int_distribution<int> key_dist(0, 3000);
+        std::uniform_int_distribution<int> op_dist(0, 2);
+
+        for (int step = 0; step < 60000; ++step) {
+            int key = key_dist(gen);
+            switch (op_dist(gen)) {
+                case 0:
+                    map.insert(key, step);
+                    reference[key] = step;
+                    break;
+                case 1:
+                    assert(map.erase(key) == (reference.erase(key) == 1));
+                    break;
+                default: {
+                    int* found = map.find(key);
+                    auto it = reference.find(key);
+                    assert((found != nullptr) == (it != reference.end()));
+                    if (found) assert(*found == it->second);
+                    break;
+                }
+            }
+            assert(map.size() == reference.size());
+        }
+        for (const auto& kv : reference) {
+            assert(map.find(kv.first) != nullptr && *map.find(kv.first) == kv.second);
+        }
+    }
+
+    void test_randomized_simd() {
+        std::cout << "SIMD available: " << (MySwissHashMap<int, int>::simd_available() ? "yes (SSE2)" : "no") << std::endl;
+        randomized_against_std(true);
+    }
+
+    void test_randomized_scalar() {
+        randomized_against_std(false);
+    }
+
+    // 反复插入/删除不同的 key，墓碑会耗尽 growth 额度，应该触发原地 rehash 而不是无限扩容
+    void test_tombstone_churn() {
+        MySwissHashMap<int, int> map(64);
+        for (int round = 0; round < 10000; ++round) {
+            map.insert(round, round);
+            if (round >= 8) {
+                assert(map.erase(round - 8));
+            }
+        }
+        assert(map.size() == 8);
+        assert(map.bucket_count() <= 64);
+        for (int i = 10000 - 8; i < 10000; ++i) {
+            assert(*map.find(i) == i);
+        }
+    }
+
+    void test_copy_and_move() {
+        MySwissHashMap<std::string, int> a;
+        for (int i = 0; i < 100; ++i) a.insert("k" + std::to_string(i), i);
+
+        MySwissHashMap<std::string, int> b = a;
+        assert(b.size() == 100);
+        b["k0"] = -1;
+        assert(*a.find("k0") == 0);
+
+        MySwissHashMap<std::string, int> c;
+        c = a;
+        assert(c.size() == 100 && *c.find("k99") == 99);
+
+        MySwissHashMap<std::string, int> d = std::move(a);
+        assert(d.size() == 100 && *d.find("k42") == 42);
+        assert(a.size() == 0 && a.find("k42") == nullptr);
+        a["again"] = 7;
+        assert(a.size() == 1 && *a.find("again") == 7);
+    }
+
+    // 以查找失败为主的负载：控制字节过滤 vs Robin Hood vs 链式
+    void test_miss_benchmark() {
+        const int N = 200000;
+        const int Q = 1000000;
+        std::mt19937_64 gen(99);
+        std::vector<std::string> keys(N);
+        for (auto& k : keys) k = "key-" + std::to_string(gen());
+        std::vector<std::string> probes(Q / 10);
+        for (auto& p : probes) p = "miss-" + std::to_string(gen());
+
+        auto run = [&](const char* label, auto& map) {
+            for (int i = 0; i < N; ++i) map.insert(keys[i], i);
+            auto t0 = std::chrono::high_resolution_clock::now();
+            long long misses = 0;
+            for (int q = 0; q < Q; ++q) misses += (map.find(probes[q % probes.size()]) == nullptr);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            assert(misses == Q);
+            std::cout << label << ": " << Q << " misses in "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        };
+
+        MySwissHashMap<std::string, int> swiss_simd;
+        MySwissHashMap<std::string, int> swiss_scalar;
+        swiss_scalar.set_simd_enabled(false);
+        MyFlatHashMap<std::string, int> flat;
+        MyHashMap<std::string, int> chained;
+        run("MySwissHashMap (SIMD)  ", swiss_simd);
+        run("MySwissHashMap (scalar)", swiss_scalar);
+        run("MyFlatHashMap          ", flat);
+        run("MyHashMap (chained)    ", chained);
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> myswisshashmap_test_cases = {
+        {"Insert and Access Test", test_insert_and_access},
+        {"Find and Erase Test", test_find_and_erase},
+        {"Rehash Test", test_rehash},
+        {"Randomized Test (SIMD path)", test_randomized_simd},
+        {"Randomized Test (scalar path)", test_randomized_scalar},
+        {"Tombstone Churn Test", test_tombstone_churn},
+        {"Copy and Move Test", test_copy_and_move},
+        {"Miss-heavy Lookup Benchmark", test_miss_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return myswisshashmap_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MySwissHashMap Tests");
+        for (const auto& test_case : myswisshashmap_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MySwissHashMap Tests Complete");
+    }
+}
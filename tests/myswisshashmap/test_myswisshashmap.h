@@ -0,0 +1,21 @@
+#ifndef TEST_MYSWISSHASHMAP_H
+#define TEST_MYSWISSHASHMAP_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMySwissHashMap {
+    void test_insert_and_access();
+    void test_find_and_erase();
+    void test_rehash();
+    void test_randomized_simd();
+    void test_randomized_scalar();
+    void test_tombstone_churn();
+    void test_copy_and_move();
+    void test_miss_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
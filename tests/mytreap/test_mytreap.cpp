@@ -3,6 +3,14 @@
 #include "MyTreap.h"
 #include <cassert>
 #include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
 
 namespace TestMyTreap {
 
@@ -209,13 +217,189 @@ namespace TestMyTreap {
     }
 
     // --- 创建测试用例注册表 ---
+    void test_order_statistics() {
+        MyTreap<int> treap;
+        std::mt19937 rng(8);
+        std::set<int> reference;
+        for (int i = 0; i < 3000; ++i) {
+            int k = static_cast<int>(rng() % 20000);
+            treap.insert(k);
+            reference.insert(k);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            int k = static_cast<int>(rng() % 20000);
+            treap.remove(k);
+            reference.erase(k);
+        }
+        std::vector<int> sorted(reference.begin(), reference.end());
+        assert(treap.size() == sorted.size());
+
+        for (size_t k = 0; k < sorted.size(); ++k) assert(*treap.select(k) == sorted[k]);
+        assert(treap.select(sorted.size()) == nullptr);
+        for (int x = -3; x <= 20003; x += 5) {
+            size_t expected = std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin();
+            assert(treap.rank(x) == expected);
+        }
+        for (int i = 0; i < 200; ++i) {
+            int lo = static_cast<int>(rng() % 20000);
+            int hi = lo + static_cast<int>(rng() % 5000);
+            size_t expected = std::lower_bound(sorted.begin(), sorted.end(), hi) -
+                              std::lower_bound(sorted.begin(), sorted.end(), lo);
+            assert(treap.count_in_range(lo, hi) == expected);
+        }
+        assert(treap.count_in_range(7, 7) == 0 && treap.count_in_range(9, 3) == 0);
+    }
+
+    void test_range_queries() {
+        MyTreap<int> tree;
+        std::mt19937 rng(19);
+        std::set<int> reference;
+        for (int i = 0; i < 3000; ++i) {
+            int k = static_cast<int>(rng() % 10000);
+            tree.insert(k);
+            reference.insert(k);
+        }
+
+        for (int q = 0; q < 300; ++q) {
+            int lo = static_cast<int>(rng() % 10200) - 100;
+            int hi = lo + static_cast<int>(rng() % 400) - 50; // 偶尔 hi <= lo，应该是空区间
+            std::vector<int> expected;
+            for (auto it = reference.lower_bound(lo); it != reference.end() && *it < hi; ++it) expected.push_back(*it);
+
+            std::vector<int> via_range;
+            for (int v : tree.range(lo, hi)) via_range.push_back(v);
+            assert(via_range == expected);
+
+            std::vector<int> via_visitor;
+            tree.for_each_in_range(lo, hi, [&](const int& v) { via_visitor.push_back(v); });
+            assert(via_visitor == expected);
+        }
+
+        // visitor 返回 false 时提前结束：只取区间里的前 5 个
+        std::vector<int> first_five;
+        tree.for_each_in_range(0, 10000, [&](const int& v) {
+            first_five.push_back(v);
+            return first_five.size() < 5;
+        });
+        assert(first_five == std::vector<int>(reference.begin(), std::next(reference.begin(), 5)));
+
+        // range 可以配合标准算法
+        auto window = tree.range(2000, 3000);
+        assert(static_cast<size_t>(std::distance(window.begin(), window.end())) == tree.count_in_range(2000, 3000));
+        assert(std::is_sorted(window.begin(), window.end()));
+
+        MyTreap<int> empty;
+        assert(empty.range(0, 100).empty());
+        int visited = 0;
+        empty.for_each_in_range(0, 100, [&](const int&) { visited++; });
+        assert(visited == 0);
+    }
+
+    void test_build_from_sorted() {
+        std::vector<int> keys;
+        for (int i = 0; i < 5000; ++i) keys.push_back(i * 3);
+
+        MyTreap<int> treap;
+        treap.insert(-1); // 原来的内容会被替换掉
+        treap.build_from_sorted(keys.begin(), keys.end());
+        assert(treap.size() == keys.size() && !treap.find(-1));
+
+        std::vector<int> inorder_result;
+        treap.inorder([&](const int& v) { inorder_result.push_back(v); });
+        assert(inorder_result == keys);
+        // 每个节点的 size 都要对：select / rank 会走遍各种路径
+        for (size_t k = 0; k < keys.size(); k += 7) {
+            assert(*treap.select(k) == keys[k]);
+            assert(treap.rank(keys[k]) == k);
+        }
+
+        // 建好之后照常插入 / 删除 (旋转依赖堆序是正确的)
+        for (int i = 0; i < 1000; ++i) treap.insert(i * 3 + 1);
+        for (int i = 0; i < 1000; ++i) treap.remove(i * 3);
+        assert(treap.size() == keys.size());
+        inorder_result.clear();
+        treap.inorder([&](const int& v) { inorder_result.push_back(v); });
+        assert(std::is_sorted(inorder_result.begin(), inorder_result.end()));
+
+        std::vector<int> with_duplicates = {5, 5, 6, 7, 7};
+        treap.build_from_sorted(with_duplicates.begin(), with_duplicates.end());
+        assert(treap.size() == 3 && treap.find(5) && treap.find(7));
+
+        std::vector<int> unsorted = {2, 1};
+        bool thrown = false;
+        try {
+            treap.build_from_sorted(unsorted.begin(), unsorted.end());
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && treap.size() == 3);
+
+        treap.build_from_sorted(keys.end(), keys.end());
+        assert(treap.empty());
+    }
+
+    static volatile long long g_sink = 0;
+
+    void test_percentile_benchmark() {
+        // 需求里是 1000 万个键。建树时每个节点都要构造一次 random_device，光建树就要十几秒，这里缩小到 20 万
+        const int N = 200000;
+        std::vector<int> keys(N);
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+        MyTreap<int> treap;
+        for (int k : keys) treap.insert(k);
+
+        using Clock = std::chrono::steady_clock;
+        const double percentiles[] = {0.5, 0.9, 0.99, 0.999};
+
+        // 现在的做法：中序遍历整棵树，数到第 k 个
+        const int SCANS = 4;
+        auto t0 = Clock::now();
+        for (int i = 0; i < SCANS; ++i) {
+            size_t target = static_cast<size_t>(percentiles[i] * (N - 1));
+            size_t index = 0;
+            int found = -1;
+            treap.inorder([&](const int& v) {
+                if (index++ == target) found = v;
+            });
+            assert(found == static_cast<int>(target));
+            g_sink = found;
+        }
+        double scan_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / SCANS;
+
+        // select：沿着 size 往下走一条路径。查询随机的排名，避免反复走同几条 (已经在缓存里的) 路径
+        const int QUERIES = 100000;
+        std::vector<size_t> targets(QUERIES);
+        std::mt19937 rng(4);
+        for (size_t& target : targets) target = rng() % N;
+        long long sum = 0;
+        t0 = Clock::now();
+        for (size_t target : targets) sum += *treap.select(target);
+        double select_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / QUERIES;
+        g_sink = sum;
+
+        // rank：反过来问“某个分数排第几”
+        t0 = Clock::now();
+        sum = 0;
+        for (int i = 0; i < QUERIES; ++i) sum += static_cast<long long>(treap.rank(keys[i]));
+        double rank_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / QUERIES;
+        g_sink = sum;
+
+        std::cout << "n = " << N << ": in-order scan " << scan_us << " us/query, select " << select_us
+                  << " us/query, rank " << rank_us << " us/query" << std::endl;
+    }
+
     static const std::vector<TestCase> mytreap_test_cases = {
         {"Insert and Find Test", test_insert_and_find},
         {"In-order is Sorted Test", test_inorder_is_sorted},
         {"Remove Test", test_remove},
         {"Resource Management (Copy/Assign)", test_resource_management},
         {"Size Basic Test", test_size_basic},
-        {"Size Copy/Assign Test", test_size_copy_and_assign}
+        {"Size Copy/Assign Test", test_size_copy_and_assign},
+        {"Order Statistics Test", test_order_statistics},
+        {"Range Queries Test", test_range_queries},
+        {"Build From Sorted Test", test_build_from_sorted},
+        {"Percentile Benchmark", test_percentile_benchmark}
     };
 
     const std::vector<TestCase>& get_test_cases() {
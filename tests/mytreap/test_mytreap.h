@@ -11,6 +11,10 @@ namespace TestMyTreap {
     void test_resource_management();
     void test_size_basic();
     void test_size_copy_and_assign();
+    void test_order_statistics();
+    void test_range_queries();
+    void test_build_from_sorted();
+    void test_percentile_benchmark();
     // Treap 一般不实现 lower/upper_bound，所以我们先不测试它们
 
     void run_all_tests();
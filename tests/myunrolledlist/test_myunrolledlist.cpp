@@ -0,0 +1,276 @@
+#include "myunrolledlist/test_myunrolledlist.h"
+#include "common/test_common.h"
+#include "MyUnrolledList.h"
+#include "MyLinkedList.h"
+#include <cassert>
+#include <chrono>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace TestMyUnrolledList {
+
+    template <typename T, size_t N>
+    static std::vector<T> to_vector(const MyUnrolledList<T, N>& list) {
+        std::vector<T> out;
+        for (auto it = list.begin(); it != list.end(); ++it) out.push_back(*it);
+        return out;
+    }
+
+    void test_push_and_pop() {
+        MyUnrolledList<int, 4> list;
+        assert(list.empty() && list.node_count() == 0);
+
+        for (int i = 0; i < 10; ++i) list.push_back(i);
+        assert(list.size() == 10);
+        assert(list.node_count() == 3); // 4 + 4 + 2
+        assert(list.front() == 0 && list.back() == 9);
+
+        list.push_front(-1);
+        list.push_front(-2);
+        assert(list.front() == -2 && list.size() == 12);
+
+        list.pop_front();
+        list.pop_back();
+        assert(list.front() == -1 && list.back() == 8 && list.size() == 10);
+
+        while (!list.empty()) list.pop_back();
+        assert(list.node_count() == 0);
+
+        // 空链表访问与删除会抛出异常
+        bool thrown = false;
+        try { list.front(); } catch (const std::out_of_range&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { list.pop_front(); } catch (const std::out_of_range&) { thrown = true; }
+        assert(thrown);
+    }
+
+    void test_iterator() {
+        MyUnrolledList<int, 3> list;
+        for (int i = 1; i <= 7; ++i) list.push_back(i * 10);
+
+        int expected = 10;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            assert(*it == expected);
+            expected += 10;
+        }
+
+        // 通过迭代器修改元素
+        for (auto it = list.begin(); it != list.end(); ++it) *it += 1;
+        assert(list.front() == 11 && list.back() == 71);
+
+        // 向后跨节点移动
+        auto it = list.begin();
+        for (int i = 0; i < 6; ++i) ++it;
+        assert(*it == 71);
+        for (int i = 0; i < 6; ++i) --it;
+        assert(it == list.begin());
+
+        const MyUnrolledList<int, 3>& cref = list;
+        int sum = 0;
+        for (auto cit = cref.cbegin(); cit != cref.cend(); ++cit) sum += *cit;
+        assert(sum == 11 + 21 + 31 + 41 + 51 + 61 + 71);
+    }
+
+    void test_insert_and_erase() {
+        MyUnrolledList<int, 4> list;
+        for (int i = 0; i < 8; ++i) list.push_back(i); // [0 1 2 3] [4 5 6 7]
+
+        // 往满的节点中间插入：节点一分为二
+        auto it = list.begin();
+        ++it;
+        ++it;
+        auto inserted = list.insert(it, 100);
+        assert(*inserted == 100);
+        assert((to_vector(list) == std::vector<int>{0, 1, 100, 2, 3, 4, 5, 6, 7}));
+        assert(list.node_count() == 3);
+
+        // 插在 end() 之前
+        auto last = list.insert(list.end(), 8);
+        assert(*last == 8 && list.back() == 8);
+
+        // erase 返回下一个元素
+        auto next = list.erase(inserted);
+        assert(*next == 2);
+        assert((to_vector(list) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+        // 边删边遍历：删掉所有偶数
+        for (auto cur = list.begin(); cur != list.end();) {
+            if (*cur % 2 == 0) cur = list.erase(cur);
+            else ++cur;
+        }
+        assert((to_vector(list) == std::vector<int>{1, 3, 5, 7}));
+        // 不到半满的节点会被合并
+        assert(list.node_count() <= 2);
+
+        // 删除最后一个元素返回 end()
+        auto tail = list.begin();
+        for (int i = 0; i < 3; ++i) ++tail;
+        assert(list.erase(tail) == list.end());
+        assert(list.back() == 5);
+
+        // 插入的值引用着链表自己的元素
+        list.insert(list.begin(), list.back());
+        assert(list.front() == 5 && list.size() == 4);
+    }
+
+    void test_randomized_against_std() {
+        MyUnrolledList<std::string, 8> list;
+        std::list<std::string> reference;
+        std::mt19937 gen(17);
+
+        for (int step = 0; step < 20000; ++step) {
+            int op = gen() % 6;
+            size_t n = reference.size();
+            if (op <= 1 || n == 0) {
+                // 在随机位置插入
+                size_t pos = n == 0 ? 0 : gen() % (n + 1);
+                auto it = list.begin();
+                auto rit = reference.begin();
+                for (size_t i = 0; i < pos; ++i) { ++it; ++rit; }
+                std::string value = std::to_string(step);
+                assert(*list.insert(it, value) == value);
+                reference.insert(rit, value);
+            }
+            else if (op == 2) {
+                size_t pos = gen() % n;
+                auto it = list.begin();
+                auto rit = reference.begin();
+                for (size_t i = 0; i < pos; ++i) { ++it; ++rit; }
+                auto next = list.erase(it);
+                auto rnext = reference.erase(rit);
+                assert((next == list.end()) == (rnext == reference.end()));
+                if (rnext != reference.end()) assert(*next == *rnext);
+            }
+            else if (op == 3) {
+                list.push_front("f" + std::to_string(step));
+                reference.push_front("f" + std::to_string(step));
+            }
+            else if (op == 4) {
+                list.pop_back();
+                reference.pop_back();
+            }
+            else {
+                list.pop_front();
+                reference.pop_front();
+            }
+            assert(list.size() == reference.size());
+        }
+        assert(to_vector(list) == std::vector<std::string>(reference.begin(), reference.end()));
+    }
+
+    void test_copy_semantics() {
+        MyUnrolledList<std::string> a;
+        for (int i = 0; i < 100; ++i) a.push_back("s" + std::to_string(i));
+
+        MyUnrolledList<std::string> b = a;
+        assert(b.size() == 100 && b.back() == "s99");
+        b.push_back("extra");
+        assert(a.size() == 100);
+
+        MyUnrolledList<std::string> c;
+        c.push_back("old");
+        c = a;
+        assert(to_vector(c) == to_vector(a));
+        c = c;
+        assert(c.size() == 100);
+    }
+
+    // 统计节点内存的分配器：给 MyLinkedList 用，得到它真实的节点开销
+    static size_t g_counted_bytes = 0;
+    static volatile long long g_sink = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) {}
+        T* allocate(size_t n) {
+            g_counted_bytes += n * sizeof(T);
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        void deallocate(T* p, size_t n) {
+            g_counted_bytes -= n * sizeof(T);
+            ::operator delete(p);
+        }
+        template <typename U>
+        bool operator==(const CountingAllocator<U>&) const { return true; }
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>&) const { return false; }
+    };
+
+    // 遍历、中间插入和内存占用：每元素一个节点 vs 展开链表
+    void test_benchmark() {
+        const int N = 1000000;
+        const int MID_INSERTS = 2000;
+
+        g_counted_bytes = 0;
+        MyLinkedList<int, CountingAllocator<int>> linked;
+        MyUnrolledList<int> unrolled;
+        for (int i = 0; i < N; ++i) {
+            linked.push_back(i);
+            unrolled.push_back(i);
+        }
+        std::cout << "memory for " << N << " ints: MyLinkedList=" << g_counted_bytes / 1024
+                  << " KB, MyUnrolledList=" << unrolled.memory_bytes() / 1024 << " KB ("
+                  << MyUnrolledList<int>::node_capacity() << " per node)" << std::endl;
+
+        auto traverse = [](const char* label, auto& list) {
+            auto t0 = std::chrono::steady_clock::now();
+            long long sum = 0;
+            for (int round = 0; round < 10; ++round) {
+                for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            g_sink = sum; // 防止优化构建把整个循环删掉
+            assert(sum == 10LL * N * (N - 1) / 2);
+            std::cout << label << " traversal x10: "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        };
+        traverse("MyLinkedList  ", linked);
+        traverse("MyUnrolledList", unrolled);
+
+        // 在固定位置 (第 1000 个元素) 反复插入：两者都要先走到那个位置
+        auto middle_insert = [&](const char* label, auto& list) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < MID_INSERTS; ++i) {
+                auto it = list.begin();
+                for (int step = 0; step < 1000; ++step) ++it;
+                list.insert(it, -i);
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            std::cout << label << " " << MID_INSERTS << " middle inserts: "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+        };
+        middle_insert("MyLinkedList  ", linked);
+        middle_insert("MyUnrolledList", unrolled);
+        assert(unrolled.size() == static_cast<size_t>(N + MID_INSERTS));
+    }
+
+    // --- 创建测试用例注册表 ---
+    static const std::vector<TestCase> myunrolledlist_test_cases = {
+        {"Push and Pop Test", test_push_and_pop},
+        {"Iterator Test", test_iterator},
+        {"Insert and Erase Test", test_insert_and_erase},
+        {"Randomized Test against std::list", test_randomized_against_std},
+        {"Copy Semantics Test", test_copy_semantics},
+        {"Traversal / Insert / Memory Benchmark", test_benchmark}
+    };
+
+    const std::vector<TestCase>& get_test_cases() {
+        return myunrolledlist_test_cases;
+    }
+
+    void run_all_tests() {
+        TestRunner::reset();
+        TestRunner::print_separator("MyUnrolledList Tests");
+        for (const auto& test_case : myunrolledlist_test_cases) {
+            TestRunner::run_test(test_case.name, test_case.function);
+        }
+        TestRunner::print_summary();
+        TestRunner::print_separator("MyUnrolledList Tests Complete");
+    }
+}
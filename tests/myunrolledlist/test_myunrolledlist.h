@@ -0,0 +1,19 @@
+#ifndef TEST_MYUNROLLEDLIST_H
+#define TEST_MYUNROLLEDLIST_H
+
+#include <vector>
+#include "common/test_common.h"
+
+namespace TestMyUnrolledList {
+    void test_push_and_pop();
+    void test_iterator();
+    void test_insert_and_erase();
+    void test_randomized_against_std();
+    void test_copy_semantics();
+    void test_benchmark();
+    void run_all_tests();
+
+    const std::vector<TestCase>& get_test_cases();
+}
+
+#endif
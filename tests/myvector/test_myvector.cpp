@@ -5,6 +5,8 @@
 #include "common/test_common.h"
 #include "MyVector.h"
 #include <stdexcept>
+#include <string>
+#include <chrono>
 
 namespace TestMyVector {
     void test_constructor() {
@@ -153,6 +155,162 @@ namespace TestMyVector {
         assert(empty_vec.begin() == empty_vec.end());
     }
 
+    // 统计构造/拷贝/移动次数的辅助类型
+    struct Tracker {
+        static int default_ctor;
+        static int copies;
+        static int moves;
+        static int live;
+        std::string payload;
+
+        Tracker() : payload("tracker") { ++default_ctor; ++live; }
+        explicit Tracker(const std::string& s) : payload(s) { ++live; }
+        Tracker(const Tracker& other) : payload(other.payload) { ++copies; ++live; }
+        Tracker(Tracker&& other) noexcept : payload(std::move(other.payload)) { ++moves; ++live; }
+        Tracker& operator=(const Tracker& other) { payload = other.payload; ++copies; return *this; }
+        Tracker& operator=(Tracker&& other) noexcept { payload = std::move(other.payload); ++moves; return *this; }
+        ~Tracker() { --live; }
+
+        static void reset() { default_ctor = copies = moves = live = 0; }
+    };
+    int Tracker::default_ctor = 0;
+    int Tracker::copies = 0;
+    int Tracker::moves = 0;
+    int Tracker::live = 0;
+
+    void test_move_semantics() {
+        MyVector<std::string> vec1;
+        vec1.push_back("alpha");
+        vec1.push_back("beta");
+
+        // 1. 移动构造：vec1 被掏空，vec2 接管缓冲区
+        MyVector<std::string> vec2 = std::move(vec1);
+        assert(vec2.size() == 2);
+        assert(vec2[0] == "alpha" && vec2[1] == "beta");
+        assert(vec1.size() == 0 && vec1.capacity() == 0);
+
+        // 2. 移动赋值
+        MyVector<std::string> vec3;
+        vec3.push_back("gamma");
+        vec3 = std::move(vec2);
+        assert(vec3.size() == 2);
+        assert(vec3[1] == "beta");
+        assert(vec2.empty());
+
+        // 3. 被移动后的对象依然可以继续使用
+        vec2.push_back("delta");
+        assert(vec2.size() == 1 && vec2[0] == "delta");
+
+        // 4. push_back(T&&) 只移动，不拷贝
+        Tracker::reset();
+        {
+            MyVector<Tracker> tv;
+            Tracker t("moved");
+            tv.push_back(std::move(t));
+            assert(Tracker::copies == 0);
+            assert(Tracker::moves == 1);
+            assert(tv[0].payload == "moved");
+        }
+        assert(Tracker::live == 0); // 所有对象都被正确析构
+        std::cout << "Move semantics test passed." << std::endl;
+    }
+
+    void test_emplace_back() {
+        Tracker::reset();
+        {
+            MyVector<Tracker> tv;
+            Tracker& ref = tv.emplace_back("in-place");
+            assert(ref.payload == "in-place");
+            assert(Tracker::copies == 0 && Tracker::moves == 0);
+
+            // 扩容 (1 -> 2 -> 4) 只移动已有元素，并且不会默认构造空闲槽位
+            tv.emplace_back("second");
+            tv.emplace_back("third");
+            assert(tv.size() == 3 && tv.capacity() == 4);
+            assert(Tracker::default_ctor == 0);
+            assert(Tracker::copies == 0);
+            assert(Tracker::live == 3);
+
+            // pop_back / clear 会真正析构元素
+            tv.pop_back();
+            assert(Tracker::live == 2);
+            tv.clear();
+            assert(Tracker::live == 0);
+        }
+
+        // 自引用：扩容时参数引用的是旧缓冲区中的元素
+        MyVector<std::string> vec;
+        vec.push_back("self");
+        vec.push_back(vec[0]); // 触发扩容 1 -> 2
+        vec.push_back(vec[1]); // 触发扩容 2 -> 4
+        assert(vec.size() == 3 && vec[2] == "self");
+
+        // resize 扩大时默认构造，缩小时析构
+        Tracker::reset();
+        {
+            MyVector<Tracker> tv;
+            tv.resize(5);
+            assert(Tracker::live == 5 && Tracker::default_ctor == 5);
+            tv.resize(2);
+            assert(Tracker::live == 2);
+        }
+        assert(Tracker::live == 0);
+        std::cout << "Emplace back test passed." << std::endl;
+    }
+
+    void test_growth_benchmark() {
+        const int N = 100000;
+
+        // 1. 统计：拷贝 push_back 与移动 push_back 的拷贝次数
+        Tracker::reset();
+        {
+            MyVector<Tracker> tv;
+            Tracker proto("payload-with-some-length");
+            for (int i = 0; i < N; ++i) tv.push_back(proto);
+        }
+        int copy_path_copies = Tracker::copies;
+        int copy_path_moves = Tracker::moves;
+
+        Tracker::reset();
+        {
+            MyVector<Tracker> tv;
+            for (int i = 0; i < N; ++i) tv.emplace_back("payload-with-some-length");
+        }
+        int emplace_path_copies = Tracker::copies;
+        int emplace_path_moves = Tracker::moves;
+        int emplace_path_defaults = Tracker::default_ctor;
+
+        // 扩容搬迁全部走移动：拷贝只来自于用户显式的 push_back(const T&)
+        assert(copy_path_copies == N);
+        assert(emplace_path_copies == 0);
+        assert(emplace_path_defaults == 0);
+        std::cout << "push_back(const T&): copies=" << copy_path_copies << ", moves=" << copy_path_moves << std::endl;
+        std::cout << "emplace_back:        copies=" << emplace_path_copies << ", moves=" << emplace_path_moves << std::endl;
+
+        // 2. 计时：扩容 vs reserve 预分配
+        auto time_it = [](const char* label, auto&& body) {
+            auto start = std::chrono::high_resolution_clock::now();
+            body();
+            auto end = std::chrono::high_resolution_clock::now();
+            std::cout << label << ": " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+        };
+        time_it("push_back std::string (grow)", [&] {
+            MyVector<std::string> vec;
+            for (int i = 0; i < N; ++i) vec.push_back(std::string(32, 'x'));
+        });
+        time_it("push_back std::string (reserve)", [&] {
+            MyVector<std::string> vec;
+            vec.reserve(N);
+            for (int i = 0; i < N; ++i) vec.push_back(std::string(32, 'x'));
+            assert(vec.capacity() == static_cast<size_t>(N));
+        });
+        time_it("push_back int (memcpy relocation)", [&] {
+            MyVector<int> vec;
+            for (int i = 0; i < N * 10; ++i) vec.push_back(i);
+            assert(vec[N * 10 - 1] == N * 10 - 1);
+        });
+    }
+
     // --- 核心改动：创建一个该模块的“测试用例注册表” ---
     static const std::vector<TestCase> myvector_test_cases = {
         {"Constructor Test", test_constructor},
@@ -161,7 +319,10 @@ namespace TestMyVector {
         {"Capacity Test", test_capacity},
         {"Copy and Assignment Test", test_copy_and_assignment},
         {"Modifiers and Capacity Test", test_modifiers_and_capacity},
-        {"Iterator Test", test_iterator}
+        {"Iterator Test", test_iterator},
+        {"Move Semantics Test", test_move_semantics},
+        {"Emplace Back Test", test_emplace_back},
+        {"Growth Benchmark", test_growth_benchmark}
     };
 
     // --- 实现管理函数 ---
@@ -13,6 +13,9 @@ namespace TestMyVector {
     void test_copy_and_assignment();
     void test_modifiers_and_capacity();
     void test_iterator();
+    void test_move_semantics();
+    void test_emplace_back();
+    void test_growth_benchmark();
     void run_all_tests();
 
     const std::vector<TestCase>& get_test_cases();